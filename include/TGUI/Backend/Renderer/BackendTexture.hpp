@@ -28,6 +28,7 @@
 
 #include <TGUI/Font.hpp>
 #include <TGUI/String.hpp>
+#include <TGUI/Rect.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <memory>
@@ -44,6 +45,18 @@ TGUI_MODULE_EXPORT namespace tgui
     {
     public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Determines what the texture keeps in memory about its pixels after it has been loaded
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        enum class PixelStorage
+        {
+            Full,      //!< All RGBA pixels are kept (4 bytes per pixel), which getPixels returns
+            AlphaMask, //!< Only 1 bit per pixel is kept, which is all that isTransparentPixel needs
+            None       //!< Nothing is kept, isTransparentPixel always returns false
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Virtual destructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -56,6 +69,8 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @param size   Width and height of the image to create
         /// @param pixels Moved pointer to array of size.x*size.y*4 bytes with RGBA pixels, or nullptr to create an empty texture
         /// @param smooth Should the smooth filter be enabled or not?
+        ///
+        /// Depending on the pixel storage of the texture, the pixels are kept or only their transparency is stored.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool load(Vector2u size, std::unique_ptr<std::uint8_t[]> pixels, bool smooth);
 
@@ -72,6 +87,33 @@ TGUI_MODULE_EXPORT namespace tgui
         virtual bool loadTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes part of the texture
+        ///
+        /// @param rect   Part of the texture to update, which has to lie within the texture
+        /// @param pixels Pointer to array of rect.width*rect.height*4 bytes with RGBA pixels
+        ///
+        /// If the texture stores its pixels or alpha mask (i.e. when it was loaded with the load function), they are updated as well.
+        ///
+        /// @return True when the texture was updated successfully
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool update(const UIntRect& rect, const std::uint8_t* pixels);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes part of the texture without updating the stored pixels
+        ///
+        /// @param rect   Part of the texture to update, which has to lie within the texture
+        /// @param pixels Pointer to array of rect.width*rect.height*4 bytes with RGBA pixels
+        ///
+        /// The default implementation uploads the entire image again, which is only possible when the pixels are stored.
+        /// Backends should override this function when they can update only the requested part of the texture.
+        ///
+        /// @return True when the texture was updated successfully
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool updateTextureOnly(const UIntRect& rect, const std::uint8_t* pixels);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the size of the entire image
         /// @return Texture size
@@ -100,7 +142,7 @@ TGUI_MODULE_EXPORT namespace tgui
         ///
         /// @param pixel  Coordinate of the pixel
         ///
-        /// @return True when the pixel is transparent, false when it is not
+        /// @return True when the pixel is transparent, false when it is not or when the pixel storage was PixelStorage::None
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD bool isTransparentPixel(Vector2u pixel) const;
 
@@ -113,12 +155,138 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD const std::uint8_t* getPixels() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes what the texture keeps in memory about its pixels
+        ///
+        /// @param storage  Which pixel data to keep when the texture is loaded
+        ///
+        /// This only affects the next call to the load function, data that is already stored isn't changed.
+        /// The pixel storage is initialized to the value returned by getDefaultPixelStorage when the texture is created.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setPixelStorage(PixelStorage storage);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns what the texture keeps in memory about its pixels
+        ///
+        /// @return Which pixel data is kept when the texture is loaded
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD PixelStorage getPixelStorage() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the backend may generate mipmaps for this texture
+        ///
+        /// @param allowed  May mipmaps be generated when the backend has them enabled?
+        ///
+        /// Textures that contain many small images next to each other and that are updated piece by piece, such as the pages
+        /// of the texture atlas and font textures, disallow mipmaps. Every partial update would otherwise regenerate the
+        /// mipmaps of the entire texture, and neighbouring images would bleed into each other at the smaller mipmap levels.
+        ///
+        /// This only affects the next call to the load function. Mipmaps are allowed by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMipmapsAllowed(bool allowed);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the backend may generate mipmaps for this texture
+        ///
+        /// @return May mipmaps be generated when the backend has them enabled?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool getMipmapsAllowed() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes what newly created textures keep in memory about their pixels
+        ///
+        /// @param storage  Which pixel data new textures keep when they are loaded
+        ///
+        /// By default, textures keep all their pixels in memory, which doubles the memory needed by an image. Images that are
+        /// loaded without a filename can however only be saved to a form file (as base64 data) when all pixels are available.
+        ///
+        /// When only the alpha mask is stored, isTransparentPixel continues to work while using 32 times less memory.
+        /// If none of the widgets need to ignore mouse events on transparent parts of their images (which is what
+        /// isTransparentPixel is used for), then no pixel data has to be kept at all.
+        ///
+        /// Changing the default only affects textures that are created afterwards.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setDefaultPixelStorage(PixelStorage storage);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns what newly created textures keep in memory about their pixels
+        ///
+        /// @return Which pixel data new textures keep when they are loaded
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static PixelStorage getDefaultPixelStorage();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets how much pixel data may be uploaded to textures per frame before postponed uploads are delayed further
+        ///
+        /// @param bytesPerFrame  Amount of bytes that may be uploaded per frame (an image has 4 bytes per pixel)
+        ///
+        /// Images that are loaded with Texture::loadAsync and svg images that are rasterized in the background don't have to be
+        /// uploaded immediately. Each frame, the gui uploads them as long as the pixel data that was uploaded since the previous
+        /// frame stays within this budget. Uploads that can't be postponed, such as glyphs that are added to a font or images
+        /// that are loaded directly, also count towards the budget. At least one postponed image of each kind is still
+        /// uploaded per frame, even when the budget is exceeded.
+        ///
+        /// Images that were loaded asynchronously are uploaded before svg images, as the latter are already being shown at
+        /// a different size while they are rasterized. The default budget is 4 MB.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setUploadBudget(std::size_t bytesPerFrame);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how much pixel data may be uploaded to textures per frame before postponed uploads are delayed further
+        ///
+        /// @return Amount of bytes that may be uploaded per frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::size_t getUploadBudget();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how much pixel data was uploaded to textures since the upload counter was last reset
+        ///
+        /// @return Amount of bytes uploaded in the current frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::size_t getUploadedByteCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Resets the amount of pixel data that was uploaded in the current frame to 0
+        ///
+        /// This function is called by the gui each time it updates its time, right after uploading the postponed textures.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void resetUploadedByteCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns whether a postponed upload still fits within the upload budget of the current frame
+        ///
+        /// @param byteCount  Amount of pixel data that would be uploaded
+        ///
+        /// @return True if the upload may happen now, false if it should be postponed to a later frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static bool isWithinUploadBudget(std::size_t byteCount);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         Vector2u m_imageSize;
         std::unique_ptr<std::uint8_t[]> m_pixels;
+        std::unique_ptr<std::uint8_t[]> m_alphaMask; // 1 bit per pixel, set for transparent pixels. Rows start at a byte boundary.
         bool m_isSmooth = true;
+        PixelStorage m_pixelStorage = m_defaultPixelStorage;
+        bool m_mipmapsAllowed = true;
+
+        static PixelStorage m_defaultPixelStorage;
+        static std::size_t m_uploadBudget;
+        static std::size_t m_uploadedByteCount; // Derived classes that don't upload via BackendTexture::loadTextureOnly add to this
     };
 }
 
@@ -62,6 +62,17 @@ TGUI_MODULE_EXPORT namespace tgui
         bool loadTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes part of the texture without updating the stored pixels
+        ///
+        /// @param rect   Part of the texture to update, which has to lie within the texture
+        /// @param pixels Pointer to array of rect.width*rect.height*4 bytes with RGBA pixels
+        ///
+        /// @return True when the texture was updated successfully
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateTextureOnly(const UIntRect& rect, const std::uint8_t* pixels) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes whether the smooth filter is enabled or not
         ///
@@ -77,10 +88,56 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD unsigned int getInternalTexture() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether mipmaps are generated for textures that are created afterwards
+        ///
+        /// @param enabled  Should textures have mipmaps?
+        ///
+        /// Mipmaps are smaller versions of the texture that are used when the texture is drawn smaller than its actual size.
+        /// They make such images look less aliased and reduce the amount of memory that needs to be read while drawing,
+        /// at the cost of using a third more memory per texture and having to regenerate them when the texture is updated.
+        /// Mipmaps are only used when the texture is smooth.
+        ///
+        /// With OpenGL ES 2.0, mipmaps are only generated for textures of which the width and height are powers of two.
+        ///
+        /// Mipmaps are disabled by default. They are never generated for textures that disallow them with setMipmapsAllowed,
+        /// which includes the pages of the texture atlas and font textures.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setMipmapsEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether mipmaps are generated for textures that are created afterwards
+        ///
+        /// @return Are mipmaps generated for new textures?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static bool getMipmapsEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the texture has mipmaps
+        ///
+        /// @return Were mipmaps generated for this texture?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool hasMipmaps() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the minification filter that matches the smooth setting and mipmaps of the texture
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD int getMinFilter() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         unsigned int m_textureId = 0;
+        bool m_hasMipmaps = false;
+
+        static bool m_mipmapsEnabled;
     };
 }
 
@@ -31,10 +31,13 @@
 #include <TGUI/Event.hpp>
 #include <TGUI/Cursor.hpp>
 #include <TGUI/TwoFingerScrollDetect.hpp>
+#include <TGUI/Optional.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <chrono>
     #include <stack>
+    #include <unordered_map>
+    #include <vector>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -572,6 +575,176 @@ TGUI_MODULE_EXPORT namespace tgui
         bool updateTime(Duration elapsedTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets whether updating the time only visits the widgets that are currently active
+        ///
+        /// @param onlyActiveWidgets  Should only widgets with e.g. a playing animation or a blinking caret be updated?
+        ///
+        /// By default, each call to updateTime() recursively visits every visible widget in the gui. When this option is enabled,
+        /// only widgets that registered themselves as needing time updates (because an animation is playing, a caret is blinking
+        /// or a double click is still possible) are visited, so the cost no longer depends on the amount of widgets in the gui.
+        ///
+        /// Custom widgets that override Widget::updateTime have to override Widget::isUpdateTimeRequired and call
+        /// Widget::requestTimeUpdates when they become active, otherwise they won't be updated when this option is enabled.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setUpdateOnlyActiveWidgets(bool onlyActiveWidgets);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether updating the time only visits the widgets that are currently active
+        ///
+        /// @return Are only widgets with e.g. a playing animation or a blinking caret updated?
+        ///
+        /// @see setUpdateOnlyActiveWidgets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool getUpdateOnlyActiveWidgets() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets whether mainLoop() blocks until something happens instead of regularly checking for events
+        ///
+        /// @param eventDriven  Should the main loop only wake up when there is work to do?
+        ///
+        /// By default, the main loop checks for new events at least every 10ms, even when nothing is happening.
+        /// When the main loop is event-driven, it waits until an event arrives, a timer expires, a tool tip has to be shown,
+        /// a texture that is loaded in the background becomes ready or a widget needs a time update (e.g. because an animation
+        /// is playing). The program thus no longer uses any CPU while idle.
+        ///
+        /// Custom widgets that override Widget::updateTime have to override Widget::isUpdateTimeRequired and call
+        /// Widget::requestTimeUpdates when they become active, otherwise they won't be updated while the gui is idle.
+        ///
+        /// This setting only affects the mainLoop() function, it has no effect when you write your own main loop.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setEventDrivenMainLoop(bool eventDriven);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether mainLoop() blocks until something happens instead of regularly checking for events
+        ///
+        /// @return Does the main loop only wake up when there is work to do?
+        ///
+        /// @see setEventDrivenMainLoop
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool getEventDrivenMainLoop() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets the maximum amount of times per second that mainLoop() redraws the screen
+        ///
+        /// @param framesPerSecond  Maximum frame rate, or 0 to not limit the frame rate (other than by vertical synchronization)
+        ///
+        /// The screen is only redrawn when something changed, this limit is reached when e.g. an animation is playing.
+        /// The default limit is 67 frames per second, which corresponds to the minimum of 15ms between frames that mainLoop()
+        /// used before this setting existed.
+        ///
+        /// This setting only affects the mainLoop() function, it has no effect when you write your own main loop.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFrameRateLimit(unsigned int framesPerSecond);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum amount of times per second that mainLoop() redraws the screen
+        ///
+        /// @return Maximum frame rate, or 0 when the frame rate isn't limited
+        ///
+        /// @see setFrameRateLimit
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD unsigned int getFrameRateLimit() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets whether consecutive mouse move events are merged into a single one
+        ///
+        /// @param coalesce  Should only the latest mouse position be passed to the widgets?
+        ///
+        /// Mice with a high polling rate and touch screens can generate many MouseMoved events per frame, each of which would
+        /// cause the widgets below the mouse to be searched and notified. When coalescing is enabled, handleEvent only stores
+        /// the position of a MouseMoved event. The widgets receive the latest position when a different event is handled, when
+        /// time is updated, when the gui is drawn or when processPendingMouseMove is called.
+        ///
+        /// handleEvent returns false for MouseMoved events while coalescing is enabled, as it isn't known yet whether the
+        /// widgets will consume the event. Coalescing is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMouseMoveCoalescing(bool coalesce);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether consecutive mouse move events are merged into a single one
+        ///
+        /// @return Is only the latest mouse position passed to the widgets?
+        ///
+        /// @see setMouseMoveCoalescing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool getMouseMoveCoalescing() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets whether the gui keeps track of all mouse positions that were merged into the last mouse move event
+        ///
+        /// @param enabled  Should the mouse positions be stored so that they can be retrieved with getMouseMoveHistory?
+        ///
+        /// Widgets that need every intermediate mouse position (e.g. a drawing canvas) can enable this and call
+        /// getMouseMoveHistory from their mouseMoved function. The history is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMouseMoveHistoryEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the gui keeps track of all mouse positions that were merged into the last mouse move event
+        ///
+        /// @return Are the mouse positions being stored?
+        ///
+        /// @see setMouseMoveHistoryEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool getMouseMoveHistoryEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the mouse positions of all MouseMoved events that were merged into the last mouse move event
+        ///
+        /// @return Mouse positions in the coordinate system that is used by the widgets, from oldest to newest
+        ///
+        /// The last element is the position that was passed to the widgets. When coalescing is disabled, the history only
+        /// contains a single position. The list is always empty when the history isn't enabled with setMouseMoveHistoryEnabled.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const std::vector<Vector2f>& getMouseMoveHistory() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Passes the mouse position of the coalesced MouseMoved events to the widgets
+        ///
+        /// @return Has the mouse move event been consumed? False is also returned when there was no pending mouse move.
+        ///
+        /// This function only has to be called manually when you need the widgets to be up-to-date before handling an event
+        /// yourself. It is called automatically when handling other events, when updating the time and when drawing.
+        ///
+        /// @see setMouseMoveCoalescing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool processPendingMouseMove();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Registers a widget that needs its updateTime function to be called. This is called by Widget::requestTimeUpdates.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addActiveWidget(Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Removes a widget from the registered active widgets, e.g. because the widget is being destroyed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeActiveWidget(Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns how long the main loop may wait for events before updateTime has to be called again.
+        /// An empty value is returned when the main loop is event-driven and nothing will happen until the next event.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Optional<Duration> getMainLoopWaitTime() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Converts the pixel coordinate to a position within the view
         /// @param pixel  coordinate on the window
@@ -609,6 +782,28 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool handleTwoFingerScroll(bool wasAlreadyScrolling);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Passes a mouse event to the widgets, without checking whether it has to be coalesced.
+        // Returns whether the event was consumed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool handleMouseEvent(const Event& event);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calls updateTime on the widgets that registered themselves as being active.
+        // Returns whether the screen has to be redrawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateTimeOfActiveWidgets(Duration elapsedTime);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the widgets that were unregistered or that no longer need their updateTime function to be called
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void pruneActiveWidgets();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the minimum time between two renders in the main loop, based on the frame rate limit
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Duration getMainLoopFrameDuration() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Updates the view and changes the size of the root container when needed.
         // Derived classes should update m_framebufferSize in this function and then call this function from the base class.
@@ -628,6 +823,13 @@ TGUI_MODULE_EXPORT namespace tgui
         std::chrono::steady_clock::time_point m_lastUpdateTime;
         bool m_windowFocused = true;
 
+        // Widgets that need their updateTime function to be called. This has to be declared before the root container,
+        // as the widgets remove themselves from this list when they are destroyed. Removed widgets are replaced by a nullptr
+        // and the list is only compacted when updating the time, the indices map each widget to its position in the list.
+        std::vector<Widget*> m_activeWidgets;
+        std::unordered_map<const Widget*, std::size_t> m_activeWidgetIndices;
+        bool m_updateOnlyActiveWidgets = false;
+
         RootContainer::Ptr m_container = std::make_shared<RootContainer>();
 
         Widget::Ptr m_visibleToolTip = nullptr;
@@ -635,6 +837,11 @@ TGUI_MODULE_EXPORT namespace tgui
         bool m_tooltipPossible = false;
         Vector2f m_toolTipRelativePos;
         Vector2i m_lastMousePos;
+        Optional<Vector2i> m_pendingMouseMove;
+        std::vector<Vector2f> m_pendingMouseMoveHistory;
+        std::vector<Vector2f> m_mouseMoveHistory;
+        bool m_mouseMoveCoalescing = false;
+        bool m_mouseMoveHistoryEnabled = false;
         TwoFingerScrollDetect m_twoFingerScroll;
 
         Vector2i m_framebufferSize;
@@ -643,6 +850,8 @@ TGUI_MODULE_EXPORT namespace tgui
         FloatRect m_lastView;
 
         bool m_drawUpdatesTime = true;
+        bool m_eventDrivenMainLoop = false;
+        unsigned int m_frameRateLimit = 67; // About 15ms between frames, like mainLoop used before the limit could be changed
         bool m_tabKeyUsageEnabled = true;
 
         Cursor::Type m_requestedMouseCursor = Cursor::Type::Arrow;
@@ -30,6 +30,8 @@
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <list>
+    #include <unordered_map>
+    #include <cstdint>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -124,6 +126,7 @@ TGUI_MODULE_EXPORT namespace tgui
         void sortWidgets(Function&& function)
         {
             std::sort(m_widgets.begin(), m_widgets.end(), std::forward<Function>(function));
+            m_spatialIndexOrderNeedsUpdate = true;
         }
 
 
@@ -147,6 +150,10 @@ TGUI_MODULE_EXPORT namespace tgui
         /// The container will first search for widgets that are direct children of it, but when none of the child widgets match
         /// the given name, a recursive search will be performed.
         ///
+        /// The names of all widgets inside the container are stored in an index when this function is first called, so that
+        /// repeated lookups don't have to search through all widgets. The index is updated when widgets are added, removed or
+        /// renamed, changing the order of the widgets doesn't affect it.
+        ///
         /// @return Pointer to the earlier added widget
         ///
         /// @warning This function will return nullptr when an unknown widget name was passed
@@ -388,6 +395,51 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD virtual Widget::Ptr getWidgetAtPosition(Vector2f pos) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether a spatial index is used to find the child widget below the mouse
+        ///
+        /// @param enabled  Should the bounding boxes of the child widgets be stored in a grid?
+        ///
+        /// Without the index, every child widget has to be checked (starting with the one in front) each time the mouse moves.
+        /// For containers with thousands of small children, the index makes it possible to only check the few widgets that lie
+        /// in the same grid cell as the mouse. The index is updated when child widgets are moved, resized or reordered.
+        ///
+        /// Widgets that can react to the mouse outside of their size (e.g. child windows, sliders and radio buttons with a text)
+        /// and widgets that are large compared to the cell size are not placed in the grid, they are always checked.
+        ///
+        /// The index is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSpatialIndexEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a spatial index is used to find the child widget below the mouse
+        ///
+        /// @return Are the bounding boxes of the child widgets stored in a grid?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isSpatialIndexEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the size of the cells in the spatial index
+        ///
+        /// @param cellSize  Width and height of a cell in the grid
+        ///
+        /// The cell size should be similar to the size of the child widgets. The default cell size is 64 pixels.
+        ///
+        /// @see setSpatialIndexEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSpatialIndexCellSize(float cellSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the cells in the spatial index
+        ///
+        /// @return Width and height of a cell in the grid
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float getSpatialIndexCellSize() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Focuses the next widget in this container
         ///
@@ -566,6 +618,30 @@ TGUI_MODULE_EXPORT namespace tgui
         void setParentGui(BackendGui* gui);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// This function is called by a child widget when its position, size, origin, scale or rotation changed.
+        /// You should not call this function yourself.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childWidgetBoundsChanged(const Widget* child);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// This function is called when a widget inside this container is renamed.
+        /// You should not call this function yourself.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childWidgetNameChanged(Widget* child, const String& oldName);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// This function is called when the widgets inside this container changed in a way that the name index can't track.
+        /// You should not call this function yourself.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateNameIndex();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -573,10 +649,10 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
-        /// @param property  Name of the property that was changed
+        /// @param property  Id of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const String& property) override;
+        void rendererPropertyChanged(RendererPropertyId property) override;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -656,6 +732,48 @@ TGUI_MODULE_EXPORT namespace tgui
         void loadWidgetsImpl(const std::unique_ptr<DataIO::Node>& rootNode, bool replaceExisting);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Places a child widget in the cells of the spatial index that overlap with its bounding box
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addToSpatialIndex(const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes a child widget from the spatial index
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeFromSpatialIndex(const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Clears the spatial index and adds all child widgets again (or leaves it empty when the index is disabled)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rebuildSpatialIndex();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the widgets inside this container by name, rebuilding the index first if it was invalidated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::unordered_map<std::u32string, std::vector<Widget*>>& getNameIndex() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds or removes the child and the named widgets inside it to the name index of this container and the ones above it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateNameIndex(Widget* child, bool added);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Appends the child (if it has a name) and the named widgets inside it to the list
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void getNamedWidgets(Widget* child, std::vector<std::pair<std::u32string, Widget*>>& namedWidgets);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Searches the widget tree for a widget with the given name, without using the name index of this container
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr findWidgetByName(const String& widgetName) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -671,6 +789,34 @@ TGUI_MODULE_EXPORT namespace tgui
         // Does focusing the next widget always keep a widget from this container focused (e.g. in a ChildWindow)?
         bool m_isolatedFocus = false;
 
+        // Location of a child widget in the spatial index
+        struct SpatialIndexEntry
+        {
+            int left = 0; // Range of cells that overlap with the widget (inclusive), unused when inGrid is false
+            int top = 0;
+            int right = 0;
+            int bottom = 0;
+            bool inGrid = false; // False if the widget has to be checked at any mouse position
+            mutable std::size_t widgetIndex = 0; // Index in m_widgets, only valid when m_spatialIndexOrderNeedsUpdate is false
+        };
+
+        bool m_spatialIndexEnabled = false;
+        float m_spatialIndexCellSize = 64;
+        std::unordered_map<const Widget*, SpatialIndexEntry> m_spatialIndexEntries;
+        std::unordered_map<std::uint64_t, std::vector<const Widget*>> m_spatialIndexCells;
+        std::vector<const Widget*> m_spatialIndexUngriddedWidgets;
+        mutable bool m_spatialIndexOrderNeedsUpdate = false;
+        mutable std::vector<std::size_t> m_spatialIndexCandidates; // Reused by getWidgetBelowMouse to avoid an allocation per mouse move
+
+        // Widgets inside this container (including those inside child containers) by name. Unnamed widgets aren't stored.
+        // The widgets are owned by the widget tree, so the index doesn't keep them alive and is updated when they are removed.
+        // If the index of a container is valid then the indices of all containers inside it are valid as well.
+        mutable std::unordered_map<std::u32string, std::vector<Widget*>> m_nameIndex;
+        mutable bool m_nameIndexValid = false;
+
+        // Parent of the SubwidgetContainer that owns this container (containers inside SubwidgetContainer have no parent)
+        Container* m_nameIndexParent = nullptr;
+
 
         friend class SubwidgetContainer; // Needs access to save and load functions
 
@@ -378,6 +378,17 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @return List of files (including directories) that are found within the given path
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD static std::vector<FileInfo> listFilesInDirectory(const Path& path);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Retrieves the information about a single file or folder
+        ///
+        /// @param path      Path to the file or directory
+        /// @param fileInfo  Output parameter that is filled in when the function succeeds
+        ///
+        /// @return True if the file exists and its information could be read, false otherwise
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static bool getFileInfo(const Path& path, FileInfo& fileInfo);
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -34,6 +34,7 @@
     #include <functional>
     #include <memory>
     #include <string>
+    #include <vector>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -219,6 +220,32 @@ TGUI_MODULE_EXPORT namespace tgui
         void recalculateValue();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts collecting layout changes instead of immediately updating the widgets that use the layouts
+        ///
+        /// Between the calls to beginBatchUpdate and endBatchUpdate, the values of layouts are still recalculated when a widget
+        /// they are bound to changes, but the position or size of the widget that uses the layout isn't updated yet.
+        /// When endBatchUpdate is called, each widget with a changed layout is updated once, after the widgets on which it
+        /// depends have been updated. This avoids recalculating the same widgets many times when e.g. the window is resized
+        /// while many layouts depend on each other.
+        ///
+        /// Layouts that depend on the position or size of other widgets may thus be outdated, and signals such as onSizeChange
+        /// and onPositionChange won't be emitted, until endBatchUpdate is called.
+        /// Calls can be nested, the widgets are only updated when the outermost endBatchUpdate is called.
+        ///
+        /// @see endBatchUpdate
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void beginBatchUpdate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Updates the widgets of which the layouts changed since beginBatchUpdate was called
+        ///
+        /// @see beginBatchUpdate
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void endBatchUpdate();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// Returns a pointer to the left operand (or nullptr if this layout does not store an operation on two operands)
@@ -250,6 +277,37 @@ TGUI_MODULE_EXPORT namespace tgui
         void resetPointers();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calls the connected widget callback, or delays the call when a batch update is in progress
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void notifyConnectedWidget();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the layout from the callbacks that are delayed by a batch update
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void cancelDelayedCallback();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Executes the delayed callback, after first executing the delayed callbacks of the widgets this layout depends on.
+        // If the other axis of the same position or size is also waiting for an update, its callback is handled at the same time.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void executeDelayedCallback(std::vector<const Layout*>& visitedLayouts);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the layout of the other axis of the position or size of the connected widget, or nullptr if not connected
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Layout* getOtherAxisLayout() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the widgets that are bound by this layout or its operands to the list
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void getBoundWidgets(std::vector<Widget*>& widgets) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Check whether sublayouts contain a string that refers to a widget which should be bound.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -262,9 +320,41 @@ TGUI_MODULE_EXPORT namespace tgui
         void parseBindingString(const String& expression, Widget* widget, bool xAxis);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Flattens the operations of this layout and its operands into a program, with constant subexpressions already evaluated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void compileProgram();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Appends the instructions that calculate the value of the given layout (this layout or one of its operands) to the program
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void compileOperand(Layout& layout);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Executes the program (compiling it first if needed) and returns the value of the layout
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float evaluateProgram();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Clears the program of the topmost layout, because the layouts that it refers to have changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateProgram();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
+        // Instruction in the compiled program of a layout
+        struct Instruction
+        {
+            Operation operation; // Value pushes a value on the stack, other operations replace the top two values by their result
+            float constant;      // Value that is pushed when the operation is Value and there is no layout
+            Layout* layout;      // Operand of which the value is pushed, or in which the result of the operation is stored
+        };
+
         float m_value = 0;
         Layout* m_parent = nullptr;
         Operation m_operation = Operation::Value;
@@ -273,6 +363,12 @@ TGUI_MODULE_EXPORT namespace tgui
         Widget* m_boundWidget = nullptr; // The widget on which this layout depends in case the operation is a binding
         String m_boundString; // String referring to a widget on which this layout depends in case the layout was created from a string and contains a binding operation
         std::function<void()> m_connectedWidgetCallback = nullptr; // Function to call when the value of the layout changes in case the layout and sublayouts are not all constants
+        Widget* m_connectedWidget = nullptr; // Widget of which this layout is the position or size, if it was connected to one
+
+        // Postfix program that calculates the value of the topmost layout from its operands. It is compiled when the value
+        // has to be recalculated for the first time after the layout was created or one of its operands was replaced.
+        std::vector<Instruction> m_program;
+        std::size_t m_programStackSize = 0; // Maximum number of values on the stack while executing the program
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
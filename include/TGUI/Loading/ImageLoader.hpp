@@ -29,6 +29,7 @@
 
 #include <TGUI/Vector2.hpp>
 #include <TGUI/String.hpp>
+#include <TGUI/Filesystem.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <cstdint>
@@ -53,6 +54,13 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @param imageSize  Output parameter that will contain the width and height of the image if loaded successfully
         ///
         /// @return RGBA array of pixels of loaded image (4 * imageSize.x * imageSize.y bytes), or nullptr if loading failed
+        ///
+        /// If a disk cache directory was set, the decoded pixels are read from the cache when the file didn't change since
+        /// it was cached, and the cache is updated otherwise.
+        ///
+        /// This function may be called from multiple threads at the same time, which TextureManager does for asynchronous loads.
+        ///
+        /// @see setDiskCacheDirectory
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD static std::unique_ptr<std::uint8_t[]> loadFromFile(const String& filename, Vector2u& imageSize);
 
@@ -67,6 +75,64 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @return RGBA array of pixels of loaded image (4 * imageSize.x * imageSize.y bytes), or nullptr if loading failed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD static std::unique_ptr<std::uint8_t[]> loadFromMemory(const std::uint8_t* data, std::size_t dataSize, Vector2u& imageSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reads the size of an image from memory without decoding the pixels
+        ///
+        /// @param data       Pointer to the file in memory
+        /// @param dataSize   Amount of bytes of the file in memory
+        /// @param imageSize  Output parameter that will contain the width and height of the image if the function succeeds
+        ///
+        /// @return True if the image format was recognized and the size could be read, false otherwise
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static bool loadImageSizeFromMemory(const std::uint8_t* data, std::size_t dataSize, Vector2u& imageSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reads the size of an image from a file without decoding the pixels
+        ///
+        /// @param filename   The file to read the size from
+        /// @param imageSize  Output parameter that will contain the width and height of the image if the function succeeds
+        ///
+        /// @return True if the image format was recognized and the size could be read, false otherwise
+        ///
+        /// Only the start of the file is read.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static bool loadImageSizeFromFile(const String& filename, Vector2u& imageSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets the directory in which loadFromFile stores the decoded pixels of the images that it loads
+        ///
+        /// @param directory  Existing directory to store the cached images in, or an empty path to disable the cache
+        ///
+        /// When the cache is enabled, each image that is loaded from a file is stored decoded in this directory. The next time
+        /// the same file is loaded (e.g. when the program is started again), the pixels are read from the cache instead of
+        /// having to decode the image again, as long as the modification time and size of the original file didn't change.
+        /// The cached files are uncompressed and thus larger than the original images. They are only meant to be used on the
+        /// computer that created them.
+        ///
+        /// Images that are loaded with Texture::loadAsync are also decoded with loadFromFile, so they use the cache as well.
+        ///
+        /// The cache is disabled by default. This function should be called before loading any images.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setDiskCacheDirectory(const Filesystem::Path& directory);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the directory in which loadFromFile stores the decoded pixels of the images that it loads
+        ///
+        /// @return Directory of the disk cache, or an empty path if the cache is disabled
+        ///
+        /// @see setDiskCacheDirectory
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static const Filesystem::Path& getDiskCacheDirectory();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        static Filesystem::Path m_diskCacheDirectory;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
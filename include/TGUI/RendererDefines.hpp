@@ -31,10 +31,21 @@
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// The name is interned only once per getter or setter. Unlike RendererPropertyId::NAME, this also works for the properties
+// of custom renderers that aren't in the list of known property names.
+#define TGUI_RENDERER_PROPERTY_INTERNED_NAME(NAME) \
+    ([]() -> const tgui::String& \
+    { \
+        static const tgui::String& internedName = tgui::WidgetRenderer::getPropertyName(tgui::WidgetRenderer::getPropertyId(#NAME)); \
+        return internedName; \
+    }())
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 #define TGUI_RENDERER_PROPERTY_OUTLINE(CLASS, NAME) \
     tgui::Outline CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
+        const auto it = m_data->propertyValuePairs.find(TGUI_RENDERER_PROPERTY_INTERNED_NAME(NAME)); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getOutline(); \
         else \
@@ -42,7 +53,7 @@
     } \
     void CLASS::set##NAME(const tgui::Outline& outline) \
     { \
-        setProperty(tgui::String(#NAME), {outline}); \
+        setProperty(TGUI_RENDERER_PROPERTY_INTERNED_NAME(NAME), {outline}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -50,7 +61,7 @@
 #define TGUI_RENDERER_PROPERTY_COLOR(CLASS, NAME, DEFAULT) \
     tgui::Color CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
+        const auto it = m_data->propertyValuePairs.find(TGUI_RENDERER_PROPERTY_INTERNED_NAME(NAME)); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getColor(); \
         else \
@@ -58,7 +69,7 @@
     } \
     void CLASS::set##NAME(tgui::Color color) \
     { \
-        setProperty(tgui::String(#NAME), {color}); \
+        setProperty(TGUI_RENDERER_PROPERTY_INTERNED_NAME(NAME), {color}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -66,7 +77,7 @@
 #define TGUI_RENDERER_PROPERTY_TEXT_STYLE(CLASS, NAME, DEFAULT) \
     tgui::TextStyles CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
+        const auto it = m_data->propertyValuePairs.find(TGUI_RENDERER_PROPERTY_INTERNED_NAME(NAME)); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getTextStyle(); \
         else \
@@ -74,7 +85,7 @@
     } \
     void CLASS::set##NAME(tgui::TextStyles style) \
     { \
-        setProperty(tgui::String(#NAME), tgui::ObjectConverter{style}); \
+        setProperty(TGUI_RENDERER_PROPERTY_INTERNED_NAME(NAME), tgui::ObjectConverter{style}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -82,7 +93,7 @@
 #define TGUI_RENDERER_PROPERTY_GET_NUMBER(CLASS, NAME, DEFAULT) \
     float CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
+        const auto it = m_data->propertyValuePairs.find(TGUI_RENDERER_PROPERTY_INTERNED_NAME(NAME)); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getNumber(); \
         else \
@@ -93,7 +104,7 @@
     TGUI_RENDERER_PROPERTY_GET_NUMBER(CLASS, NAME, DEFAULT) \
     void CLASS::set##NAME(float number) \
     { \
-        setProperty(tgui::String(#NAME), tgui::ObjectConverter{number}); \
+        setProperty(TGUI_RENDERER_PROPERTY_INTERNED_NAME(NAME), tgui::ObjectConverter{number}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -101,7 +112,7 @@
 #define TGUI_RENDERER_PROPERTY_GET_BOOL(CLASS, NAME, DEFAULT) \
     bool CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
+        const auto it = m_data->propertyValuePairs.find(TGUI_RENDERER_PROPERTY_INTERNED_NAME(NAME)); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getBool(); \
         else \
@@ -112,7 +123,7 @@
     TGUI_RENDERER_PROPERTY_GET_BOOL(CLASS, NAME, DEFAULT) \
     void CLASS::set##NAME(bool flag) \
     { \
-        setProperty(tgui::String(#NAME), tgui::ObjectConverter{flag}); \
+        setProperty(TGUI_RENDERER_PROPERTY_INTERNED_NAME(NAME), tgui::ObjectConverter{flag}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -120,18 +131,18 @@
 #define TGUI_RENDERER_PROPERTY_TEXTURE(CLASS, NAME) \
     const tgui::Texture& CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
+        const auto it = m_data->propertyValuePairs.find(TGUI_RENDERER_PROPERTY_INTERNED_NAME(NAME)); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getTexture(); \
         else \
         { \
-            m_data->propertyValuePairs[tgui::String(#NAME)] = {tgui::Texture{}}; \
-            return m_data->propertyValuePairs[tgui::String(#NAME)].getTexture(); \
+            m_data->propertyValuePairs[TGUI_RENDERER_PROPERTY_INTERNED_NAME(NAME)] = {tgui::Texture{}}; \
+            return m_data->propertyValuePairs[TGUI_RENDERER_PROPERTY_INTERNED_NAME(NAME)].getTexture(); \
         } \
     } \
     void CLASS::set##NAME(const tgui::Texture& texture) \
     { \
-        setProperty(tgui::String(#NAME), {texture}); \
+        setProperty(TGUI_RENDERER_PROPERTY_INTERNED_NAME(NAME), {texture}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -139,22 +150,22 @@
 #define TGUI_RENDERER_PROPERTY_RENDERER_WITH_DEFAULT(CLASS, NAME, RENDERER, DEFAULT) \
     std::shared_ptr<tgui::RendererData> CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
+        const auto it = m_data->propertyValuePairs.find(TGUI_RENDERER_PROPERTY_INTERNED_NAME(NAME)); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getRenderer(); \
         else \
         { \
             const auto& renderer = tgui::Theme::getDefault()->getRendererNoThrow(RENDERER); \
-            m_data->propertyValuePairs[tgui::String(#NAME)] = {renderer ? renderer : (DEFAULT)}; \
+            m_data->propertyValuePairs[TGUI_RENDERER_PROPERTY_INTERNED_NAME(NAME)] = {renderer ? renderer : (DEFAULT)}; \
             return renderer; \
         } \
     } \
     void CLASS::set##NAME(std::shared_ptr<tgui::RendererData> renderer) \
     { \
         if (renderer) \
-            setProperty(tgui::String(#NAME), {std::move(renderer)}); \
+            setProperty(TGUI_RENDERER_PROPERTY_INTERNED_NAME(NAME), {std::move(renderer)}); \
         else \
-            setProperty(tgui::String(#NAME), {RendererData::create()}); \
+            setProperty(TGUI_RENDERER_PROPERTY_INTERNED_NAME(NAME), {RendererData::create()}); \
     }
 
 #define TGUI_RENDERER_PROPERTY_RENDERER(CLASS, NAME, RENDERER) \
@@ -0,0 +1,232 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_RENDERER_PROPERTY_ID_HPP
+#define TGUI_RENDERER_PROPERTY_ID_HPP
+
+#include <TGUI/Config.hpp>
+
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <cstdint>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Names of all renderer properties that are used by the widgets in TGUI, in alphabetical order
+#define TGUI_RENDERER_PROPERTY_NAMES(X) \
+    X(ArrowBackgroundColor) \
+    X(ArrowBackgroundColorDisabled) \
+    X(ArrowBackgroundColorHover) \
+    X(ArrowColor) \
+    X(ArrowColorDisabled) \
+    X(ArrowColorHover) \
+    X(ArrowsOnNavigationButtonsVisible) \
+    X(BackButton) \
+    X(BackgroundColor) \
+    X(BackgroundColorChecked) \
+    X(BackgroundColorCheckedDisabled) \
+    X(BackgroundColorCheckedHover) \
+    X(BackgroundColorDisabled) \
+    X(BackgroundColorDown) \
+    X(BackgroundColorDownDisabled) \
+    X(BackgroundColorDownFocused) \
+    X(BackgroundColorDownHover) \
+    X(BackgroundColorFocused) \
+    X(BackgroundColorHover) \
+    X(BorderBelowTitleBar) \
+    X(BorderBetweenArrows) \
+    X(BorderColor) \
+    X(BorderColorChecked) \
+    X(BorderColorCheckedDisabled) \
+    X(BorderColorCheckedFocused) \
+    X(BorderColorCheckedHover) \
+    X(BorderColorDisabled) \
+    X(BorderColorDown) \
+    X(BorderColorDownDisabled) \
+    X(BorderColorDownFocused) \
+    X(BorderColorDownHover) \
+    X(BorderColorFocused) \
+    X(BorderColorHover) \
+    X(Borders) \
+    X(Button) \
+    X(CaretColor) \
+    X(CaretColorFocused) \
+    X(CaretColorHover) \
+    X(CaretWidth) \
+    X(CheckColor) \
+    X(CheckColorDisabled) \
+    X(CheckColorHover) \
+    X(CloseButton) \
+    X(Color) \
+    X(DefaultTextColor) \
+    X(DefaultTextStyle) \
+    X(DistanceToSide) \
+    X(EditBox) \
+    X(FileTypeComboBox) \
+    X(FilenameLabel) \
+    X(FillColor) \
+    X(Font) \
+    X(ForwardButton) \
+    X(GridLinesColor) \
+    X(HeaderBackgroundColor) \
+    X(HeaderTextColor) \
+    X(ImageRotation) \
+    X(ItemsBackgroundColor) \
+    X(ItemsBackgroundColorHover) \
+    X(Label) \
+    X(ListBox) \
+    X(ListView) \
+    X(MaximizeButton) \
+    X(MinimizeButton) \
+    X(MinimumResizableBorderWidth) \
+    X(Opacity) \
+    X(OpacityDisabled) \
+    X(Padding) \
+    X(PaddingBetweenButtons) \
+    X(RoundedBorderRadius) \
+    X(Scrollbar) \
+    X(ScrollbarWidth) \
+    X(SelectedBackgroundColor) \
+    X(SelectedBackgroundColorHover) \
+    X(SelectedBorderColor) \
+    X(SelectedBorderColorHover) \
+    X(SelectedItemsBackgroundColor) \
+    X(SelectedItemsBackgroundColorHover) \
+    X(SelectedTextBackgroundColor) \
+    X(SelectedTextColor) \
+    X(SelectedTextColorHover) \
+    X(SelectedTextStyle) \
+    X(SelectedTrackColor) \
+    X(SelectedTrackColorHover) \
+    X(SeparatorColor) \
+    X(SeparatorSidePadding) \
+    X(SeparatorThickness) \
+    X(SeparatorVerticalPadding) \
+    X(ShowTextOnTitleButtons) \
+    X(Slider) \
+    X(SpaceBetweenWidgets) \
+    X(TextColor) \
+    X(TextColorChecked) \
+    X(TextColorCheckedDisabled) \
+    X(TextColorCheckedHover) \
+    X(TextColorDisabled) \
+    X(TextColorDown) \
+    X(TextColorDownDisabled) \
+    X(TextColorDownFocused) \
+    X(TextColorDownHover) \
+    X(TextColorFilled) \
+    X(TextColorFocused) \
+    X(TextColorHover) \
+    X(TextDistanceRatio) \
+    X(TextOutlineColor) \
+    X(TextOutlineThickness) \
+    X(TextSize) \
+    X(TextStyle) \
+    X(TextStyleChecked) \
+    X(TextStyleDisabled) \
+    X(TextStyleDown) \
+    X(TextStyleDownDisabled) \
+    X(TextStyleDownFocused) \
+    X(TextStyleDownHover) \
+    X(TextStyleFocused) \
+    X(TextStyleHover) \
+    X(Texture) \
+    X(TextureArrow) \
+    X(TextureArrowDisabled) \
+    X(TextureArrowDown) \
+    X(TextureArrowDownHover) \
+    X(TextureArrowHover) \
+    X(TextureArrowUp) \
+    X(TextureArrowUpHover) \
+    X(TextureBackground) \
+    X(TextureBackgroundDisabled) \
+    X(TextureBranchCollapsed) \
+    X(TextureBranchExpanded) \
+    X(TextureChecked) \
+    X(TextureCheckedDisabled) \
+    X(TextureCheckedFocused) \
+    X(TextureCheckedHover) \
+    X(TextureDisabled) \
+    X(TextureDisabledTab) \
+    X(TextureDown) \
+    X(TextureDownDisabled) \
+    X(TextureDownFocused) \
+    X(TextureDownHover) \
+    X(TextureFill) \
+    X(TextureFocused) \
+    X(TextureForeground) \
+    X(TextureHeaderBackground) \
+    X(TextureHover) \
+    X(TextureItemBackground) \
+    X(TextureLeaf) \
+    X(TextureSelectedItemBackground) \
+    X(TextureSelectedTab) \
+    X(TextureSelectedTabHover) \
+    X(TextureSelectedTrack) \
+    X(TextureSelectedTrackHover) \
+    X(TextureTab) \
+    X(TextureTabHover) \
+    X(TextureThumb) \
+    X(TextureThumbHover) \
+    X(TextureTitleBar) \
+    X(TextureTrack) \
+    X(TextureTrackHover) \
+    X(TextureUnchecked) \
+    X(TextureUncheckedDisabled) \
+    X(TextureUncheckedFocused) \
+    X(TextureUncheckedHover) \
+    X(ThumbColor) \
+    X(ThumbColorHover) \
+    X(ThumbWithinTrack) \
+    X(TitleBarColor) \
+    X(TitleBarHeight) \
+    X(TitleColor) \
+    X(TrackColor) \
+    X(TrackColorHover) \
+    X(TransparentTexture) \
+    X(UpButton)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TGUI_MODULE_EXPORT namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Integer id of an interned renderer property name
+    ///
+    /// The properties used by the widgets in TGUI have a named id. Other property names (e.g. properties of custom widgets)
+    /// get an id starting from KnownPropertyCount when they are first passed to WidgetRenderer::getPropertyId.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    enum class RendererPropertyId : std::uint32_t
+    {
+#define TGUI_RENDERER_PROPERTY_ID_ENUMERATOR(NAME) NAME,
+        TGUI_RENDERER_PROPERTY_NAMES(TGUI_RENDERER_PROPERTY_ID_ENUMERATOR)
+#undef TGUI_RENDERER_PROPERTY_ID_ENUMERATOR
+        KnownPropertyCount //!< Amount of named ids
+    };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_RENDERER_PROPERTY_ID_HPP
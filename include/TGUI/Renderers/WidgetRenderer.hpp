@@ -29,6 +29,7 @@
 
 #include <TGUI/Config.hpp>
 #include <TGUI/ObjectConverter.hpp>
+#include <TGUI/Renderers/RendererPropertyId.hpp>
 #include <TGUI/Loading/DataIO.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
@@ -231,6 +232,31 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD const std::map<String, ObjectConverter>& getPropertyValuePairs() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the integer id of a property name
+        ///
+        /// @param property  Name of the property
+        ///
+        /// @return Id of the property. The same name will always result in the same id.
+        ///
+        /// Names that aren't used by any of the widgets in TGUI are given a new id the first time this function is called.
+        ///
+        /// @warning The ids are stored in a global table that isn't protected by a mutex. Just like the rest of the gui,
+        ///          this function and getPropertyName may only be called from one thread at a time.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static RendererPropertyId getPropertyId(const String& property);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the name of the property that belongs to an id
+        ///
+        /// @param id  Id of the property, as returned by getPropertyId
+        ///
+        /// @return Name of the property
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static const String& getPropertyName(RendererPropertyId id);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Subscribes a callback function to changes in the renderer
         ///
@@ -135,11 +135,11 @@ TGUI_MODULE_EXPORT namespace tgui
             const auto id = ++m_lastSignalId;
 #if defined(__cpp_if_constexpr) && (__cpp_if_constexpr >= 201606L)
             if constexpr(sizeof...(BoundArgs) == 0)
-                m_handlers[id] = func;
+                addHandler(id, std::function<void()>(func));
             else
 #endif
             {
-                m_handlers[id] = [=]{ invokeFunc(func, args...); };
+                addHandler(id, [=]{ invokeFunc(func, args...); });
             }
 
             return id;
@@ -184,6 +184,10 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @param widget  The sender of the signal
         ///
         /// @return True when at least one signal handler was called
+        ///
+        /// Emitting the signal doesn't allocate memory. Handlers are called in the order in which they were connected.
+        /// A handler that is disconnected while the signal is being emitted will no longer be called, a handler that is
+        /// connected while the signal is being emitted will only be called on the next emit.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget);
 
@@ -230,6 +234,24 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stores a new signal handler
+        ///
+        /// @param id    Unique id of the connection
+        /// @param func  Function to call when the signal is emitted
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addHandler(unsigned int id, std::function<void()>&& func);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether there are signal handlers connected to this signal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool hasHandlers() const
+        {
+            return m_handlers && (!m_handlers->handlers.empty() || !m_handlers->pendingHandlers.empty());
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Extracts the widget stored in the first parameter
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -271,9 +293,24 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        struct Handler
+        {
+            unsigned int id; // 0 when the handler was disconnected during an emit
+            std::function<void()> func;
+        };
+
+        // The list is shared so that emit can keep it alive when the signal is destroyed by one of its handlers
+        struct HandlerList
+        {
+            std::vector<Handler> handlers;
+            std::vector<Handler> pendingHandlers; // Handlers that were connected during an emit
+            unsigned int emitDepth = 0;
+            bool containsDisconnectedHandlers = false;
+        };
+
         bool m_enabled = true;
         String m_name;
-        std::unordered_map<unsigned int, std::function<void()>> m_handlers;
+        std::shared_ptr<HandlerList> m_handlers; // Only allocated when the first handler is connected
 
         static unsigned int m_lastSignalId;
         static std::deque<const void*> m_parameters;
@@ -355,7 +392,7 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, T param)
         {
-            if (m_handlers.empty())
+            if (!hasHandlers())
                 return false;
 
             m_parameters[1] = static_cast<const void*>(&param);
@@ -440,7 +477,7 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, T1 param1, T2 param2)
         {
-            if (m_handlers.empty())
+            if (!hasHandlers())
                 return false;
 
             m_parameters[1] = static_cast<const void*>(&param1);
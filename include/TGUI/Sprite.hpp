@@ -242,11 +242,19 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// Returns the internal SVG texture for drawing.
+        ///
+        /// While the image is being rasterized in the background, the texture of the previous size is returned.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        TGUI_NODISCARD const std::shared_ptr<BackendTexture>& getSvgTexture() const
-        {
-            return m_svgTexture;
-        }
+        TGUI_NODISCARD const std::shared_ptr<BackendTexture>& getSvgTexture() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns the downscaled copy of the texture that is drawn instead of the texture itself, or nullptr if there is none.
+        ///
+        /// @see TextureManager::setDownscalingEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const std::shared_ptr<BackendTexture>& getDownscaledTexture() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -284,6 +292,8 @@ TGUI_MODULE_EXPORT namespace tgui
         Vector2f    m_size;
         Texture     m_texture;
         std::shared_ptr<BackendTexture> m_svgTexture;
+        std::shared_ptr<BackendTexture> m_svgStaleTexture; // Drawn until m_svgTexture has been rasterized in the background
+        std::shared_ptr<BackendTexture> m_downscaledTexture;
         std::vector<Vertex> m_vertices;
         std::vector<unsigned int> m_indices;
 
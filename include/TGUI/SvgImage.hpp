@@ -99,6 +99,117 @@ TGUI_MODULE_EXPORT namespace tgui
         void rasterize(BackendTexture& texture, Vector2u size);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns a texture containing the image drawn at the requested size
+        ///
+        /// @param size  Size that the texture should have
+        ///
+        /// Rasterized textures are cached, so that all sprites that draw the same image at the same size share a single texture.
+        ///
+        /// @return Texture containing the rasterized image
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::shared_ptr<BackendTexture> getRasterizedTexture(Vector2u size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns a texture containing the image drawn at the requested size, which is rasterized on a worker thread
+        ///
+        /// @param size  Size that the texture should have
+        ///
+        /// If the texture wasn't cached yet then the returned texture has a size of 0x0 until processBackgroundRasterizations
+        /// uploads the rasterized image to it. The caller is expected to keep drawing its previous texture until then.
+        ///
+        /// @return Texture containing the rasterized image, or an empty texture if the image is still being rasterized
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::shared_ptr<BackendTexture> getRasterizedTextureAsync(Vector2u size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Uploads the images that were rasterized by worker threads since the last call
+        ///
+        /// @return True if any texture was updated, in which case the screen has to be redrawn
+        ///
+        /// This function is called by the gui each time it updates its time. Images that don't fit within the upload budget
+        /// of the frame are uploaded in a later call (see BackendTexture::setUploadBudget).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool processBackgroundRasterizations();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of images that are still being rasterized by worker threads
+        ///
+        /// @return Number of rasterizations that haven't been processed yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::size_t getBackgroundRasterizationCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets whether sprites rasterize their svg image on worker threads when their size changes
+        ///
+        /// @param enabled  Should svg images that were already drawn be rasterized in the background when resized?
+        ///
+        /// When enabled, a sprite that gets resized keeps drawing its previous texture (stretched to the new size) until the
+        /// image has been rasterized at the new size. Sizes are also rounded up to a limited amount of buckets (see
+        /// getRasterizationBucketSize), so that continuously resizing a sprite doesn't rasterize the image at every pixel size.
+        /// The first time a sprite is drawn, the image is still rasterized immediately.
+        ///
+        /// Background rasterization is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setBackgroundRasterization(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether sprites rasterize their svg image on worker threads when their size changes
+        ///
+        /// @return Are svg images rasterized in the background when resized?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static bool getBackgroundRasterization();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the size at which an image is rasterized when background rasterization is enabled
+        ///
+        /// @param size  Size at which the image will be drawn
+        ///
+        /// Sizes up to 16 pixels are kept unchanged. Larger sizes are rounded up to a multiple of 1/8th of the largest power of
+        /// two that doesn't exceed the size, so the image is never rasterized more than 12.5% larger than needed.
+        ///
+        /// @return Size of the texture to rasterize the image in
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static Vector2u getRasterizationBucketSize(Vector2u size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets how many rasterized textures are kept in the cache while no sprite is using them
+        ///
+        /// @param maxUnusedTextures  Maximum amount of unused textures that remain cached
+        ///
+        /// When the limit is exceeded, the textures that were least recently requested are removed first.
+        /// Textures that are still in use are never removed from the cache. The default limit is 32.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setRasterizationCacheLimit(std::size_t maxUnusedTextures);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many rasterized textures are kept in the cache while no sprite is using them
+        ///
+        /// @return Maximum amount of unused textures that remain cached
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::size_t getRasterizationCacheLimit();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns how many rasterized textures are currently cached, both used and unused ones
+        ///
+        /// @return Number of textures in the rasterization cache
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::size_t getRasterizationCacheSize();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
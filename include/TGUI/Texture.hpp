@@ -61,6 +61,7 @@ TGUI_MODULE_EXPORT namespace tgui
         using CallbackFunc = std::function<void(std::shared_ptr<TextureData>)>;
         using BackendTextureLoaderFunc = std::function<bool(BackendTexture&, const String&, bool smooth)>;
         using TextureLoaderFunc = std::function<std::shared_ptr<TextureData>(Texture&, const String&, bool smooth)>;
+        using AsyncLoadCallbackFunc = std::function<void(bool success)>;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -164,6 +165,34 @@ TGUI_MODULE_EXPORT namespace tgui
                   const UIntRect& middleRect = {},
                   bool smooth = m_defaultSmooth);
 
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates the texture while decoding the image in the background
+        ///
+        /// @param id         Id for the the image to load (for the default loader, the id is the filename)
+        /// @param onLoaded   Function that is called when the image has been decoded and uploaded (or when decoding failed)
+        /// @param partRect   Load only part of the image. Don't pass this parameter if you want to load the full image
+        /// @param middleRect Choose the middle part of the image for 9-slice scaling (relative to the part defined by partRect)
+        /// @param smooth     Enable smoothing on the texture
+        ///
+        /// Only the size of the image is read from the file before this function returns, so the texture can be given to
+        /// widgets immediately. Until the image is ready, the texture is drawn as if it was fully transparent. The file is
+        /// read and decoded on a worker thread (using the disk cache if ImageLoader::setDiskCacheDirectory was called) and
+        /// the pixels are uploaded when the gui updates its time, within the upload budget that is set with
+        /// TextureManager::setAsyncUploadBudget.
+        ///
+        /// The onLoaded callback is called from the thread that updates the gui. When the image was already loaded, or when
+        /// it can't be loaded asynchronously (e.g. svg images or when a custom texture loader is set), the image is loaded
+        /// like in the load function and the callback is called before this function returns.
+        ///
+        /// @throw Exception when the file could not be read or isn't a supported image
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadAsync(const String& id,
+                       const AsyncLoadCallbackFunc& onLoaded = nullptr,
+                       const UIntRect& partRect = {},
+                       const UIntRect& middleRect = {},
+                       bool smooth = m_defaultSmooth);
+
 #if TGUI_HAS_RENDERER_BACKEND_SFML_GRAPHICS
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Creates the texture from an existing sf::Texture
@@ -269,6 +298,14 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD bool isSmooth() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the image is still being loaded in the background
+        ///
+        /// @return True when the texture was loaded with loadAsync and the image isn't ready yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isLoading() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Sets the global color of the texture
         ///
@@ -35,6 +35,9 @@
 #include <TGUI/Backend/Renderer/BackendTexture.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <cstdint>
+    #include <list>
+    #include <map>
     #include <memory>
     #include <string>
 #endif
@@ -51,6 +54,17 @@ TGUI_MODULE_EXPORT namespace tgui
         // Either svgImage or backendTexture MUST have a value
         Optional<SvgImage> svgImage;
         std::shared_ptr<BackendTexture> backendTexture;
+
+        // True while the image is still being decoded in the background (see Texture::loadAsync).
+        // The backend texture already has the correct size, but its contents are undefined and it shouldn't be drawn yet.
+        bool loading = false;
+
+        // Part of the backend texture that contains the image when the TextureManager packed it in a texture atlas.
+        // The rectangle is empty when the image fills the entire backend texture.
+        UIntRect atlasRect;
+
+        // Smaller copies of the backend texture, created by TextureManager::getDownscaledTexture. The key is the downscale factor.
+        std::map<unsigned int, std::shared_ptr<BackendTexture>> downscaledTextures;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -62,6 +76,7 @@ TGUI_MODULE_EXPORT namespace tgui
         String  filename;
         bool smooth = true;
         unsigned int users = 0;
+        std::list<TextureDataHolder*>::iterator unusedIt; // Position in the list of cached images that are unused, only valid while users is 0
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -31,6 +31,7 @@
 #include <TGUI/TextureData.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <functional>
     #include <memory>
     #include <list>
     #include <map>
@@ -47,6 +48,22 @@ TGUI_MODULE_EXPORT namespace tgui
     class TGUI_API TextureManager
     {
     public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Statistics about the images that are loaded by the texture manager
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct Statistics
+        {
+            std::size_t hits = 0;           //!< Number of times a requested image was already loaded (or still cached)
+            std::size_t misses = 0;         //!< Number of times a requested image had to be loaded
+            std::size_t evictions = 0;      //!< Number of unused images that were removed to stay within the cache budget
+            std::size_t bytesResident = 0;  //!< Bytes of pixel data in all loaded images, both used and unused ones
+            std::size_t bytesUnused = 0;    //!< Part of bytesResident that belongs to images that are only kept for the cache
+            std::size_t unusedImages = 0;   //!< Number of images that are no longer used but are still cached
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Loads a texture
         ///
@@ -62,6 +79,195 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD static std::shared_ptr<TextureData> getTexture(Texture& texture, const String& filename, bool smooth);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads a texture while decoding the image on a worker thread
+        ///
+        /// @param texture    The texture object that will store the loaded image
+        /// @param filename   Filename of the image to load
+        /// @param smooth     Enable smoothing on the texture
+        /// @param onLoaded   Function to call once the image has been uploaded, only used when the returned data is still loading
+        ///
+        /// The file is read and its header is parsed before this function returns. The returned texture data has a backend
+        /// texture of the correct size, but its loading member remains true until processAsyncLoads uploads the pixels.
+        /// Svg images and images that are already cached are loaded immediately, like in getTexture.
+        ///
+        /// @return Texture data when the file was read successfully, nullptr otherwise
+        ///
+        /// @see Texture::loadAsync
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::shared_ptr<TextureData> getTextureAsync(Texture& texture, const String& filename, bool smooth,
+                                                                           const std::function<void(bool success)>& onLoaded);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Uploads the images that were decoded in the background since the last call
+        ///
+        /// @return True if any texture finished loading, in which case the screen has to be redrawn
+        ///
+        /// This function is called by the gui each time it updates its time. Textures are uploaded in the order in which they
+        /// were requested until the upload budget is exhausted, the remaining ones are uploaded on the next call.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool processAsyncLoads();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of textures that were requested with getTextureAsync and haven't been uploaded yet
+        ///
+        /// @return Number of textures that are still loading
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::size_t getAsyncLoadCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets the maximum amount of pixel data that is uploaded per frame
+        ///
+        /// @param bytesPerFrame  Amount of bytes that may be uploaded per frame (an image has 4 bytes per pixel)
+        ///
+        /// This is the same as calling BackendTexture::setUploadBudget. At least one image is always uploaded per call to
+        /// processAsyncLoads, even if it is larger than the remaining budget. The default budget is 4 MB.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAsyncUploadBudget(std::size_t bytesPerFrame);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum amount of pixel data that is uploaded per frame
+        ///
+        /// @return Amount of bytes that may be uploaded per frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::size_t getAsyncUploadBudget();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets whether small images should be packed together in shared textures
+        ///
+        /// @param enabled  Should images that are loaded afterwards be placed in a texture atlas when they are small enough?
+        ///
+        /// Every image normally gets its own backend texture, which means that the renderer has to switch textures for each
+        /// small icon that gets drawn. When the atlas is enabled, images of which neither the width nor the height exceeds the
+        /// atlas image size limit are copied into a shared texture instead. Textures that were already loaded aren't affected.
+        ///
+        /// The atlas is disabled by default. While it is enabled, the backend texture loader is given a texture that only stores
+        /// the pixels in memory, which are then copied to the actual backend texture.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAtlasEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether small images are packed together in shared textures
+        ///
+        /// @return Are images that are loaded placed in a texture atlas when they are small enough?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static bool getAtlasEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets the maximum width and height of images that are placed in the texture atlas
+        ///
+        /// @param maxSize  Images with a larger width or height get their own texture. The default limit is 64 pixels.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAtlasImageSizeLimit(unsigned int maxSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum width and height of images that are placed in the texture atlas
+        ///
+        /// @return Maximum size of an image in the atlas
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static unsigned int getAtlasImageSizeLimit();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns how many textures are currently being used by the texture atlas
+        ///
+        /// @return Number of atlas pages
+        ///
+        /// A page is removed again as soon as none of the images that were placed on it are still in use.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::size_t getAtlasPageCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets whether images that are drawn much smaller than their size should be drawn from a downscaled copy
+        ///
+        /// @param enabled  Should downscaled copies of images be created?
+        ///
+        /// When a sprite is at most half as wide and half as high as its image, a copy of the image that is downscaled by a
+        /// power of two (but is still at least as large as the sprite) is created and drawn instead of the full image.
+        /// The copy is shared by all sprites that show the same image at a similar size. This avoids aliasing and reduces the
+        /// amount of memory that has to be read when drawing e.g. thumbnails, at the cost of keeping the copy in memory as well.
+        ///
+        /// Only images of which the pixels are stored (see BackendTexture::setPixelStorage) and that aren't part of the
+        /// texture atlas can be downscaled. The copies aren't updated when the pixels of the original texture are changed.
+        /// This option is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setDownscalingEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether images that are drawn much smaller than their size should be drawn from a downscaled copy
+        ///
+        /// @return Are downscaled copies of images created?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static bool getDownscalingEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns a copy of the image of which the width and height are divided by a given factor
+        ///
+        /// @param data    Texture data containing the image
+        /// @param factor  Amount by which the width and height are divided
+        ///
+        /// @return Downscaled texture, or nullptr if the image can't be downscaled
+        ///
+        /// The copy is created the first time it is requested and is stored in the texture data.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::shared_ptr<BackendTexture> getDownscaledTexture(TextureData& data, unsigned int factor);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets how much memory may be used to keep images loaded while no texture uses them anymore
+        ///
+        /// @param bytes  Maximum amount of pixel data in unused images (an image has 4 bytes per pixel)
+        ///
+        /// By default the budget is 0, which means that an image is removed from memory as soon as it is no longer used.
+        /// With a larger budget, images that are no longer used remain loaded so that they can be reused without having to load
+        /// them from disk again (e.g. when switching back and forth between screens). When the unused images exceed the budget,
+        /// the ones that have been unused for the longest time are removed first. Images that are in use are never removed.
+        /// Svg images are always removed immediately, as they aren't rasterized by the texture manager.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setCacheBudget(std::size_t bytes);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how much memory may be used to keep images loaded while no texture uses them anymore
+        ///
+        /// @return Maximum amount of pixel data in unused images
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::size_t getCacheBudget();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all images that are no longer used from memory, regardless of the cache budget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void removeUnusedTextures();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns statistics about the images that are loaded by the texture manager
+        ///
+        /// @return Hits, misses and evictions since the statistics were last reset, and the current memory usage
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static Statistics getStatistics();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Resets the hit, miss and eviction counters of the statistics to 0
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void resetStatistics();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Shares the image with another texture
         ///
@@ -76,7 +282,8 @@ TGUI_MODULE_EXPORT namespace tgui
         ///
         /// @param textureDataToRemove  The texture data that should be removed
         ///
-        /// When no other texture is using the same image then the image will be removed from memory.
+        /// When no other texture is using the same image then the image will be removed from memory, unless it can remain cached
+        /// within the cache budget.
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static void removeTexture(const std::shared_ptr<TextureData>& textureDataToRemove);
@@ -97,6 +304,11 @@ TGUI_MODULE_EXPORT namespace tgui
     protected:
 
         static std::map<String, std::list<TextureDataHolder>> m_imageMap;
+        static bool m_atlasEnabled;
+        static unsigned int m_atlasImageSizeLimit;
+        static std::size_t m_cacheBudget;
+        static bool m_downscalingEnabled;
+        static Statistics m_statistics;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -34,6 +34,7 @@
     #include <functional>
     #include <memory>
     #include <vector>
+    #include <cstdint>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -183,14 +184,53 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the timer to the active timers, or moves it to the correct place if it was already active
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void schedule(Duration deadline);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the timer from the active timers
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void unschedule();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the left timer has to be triggered before the right timer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static bool isScheduledBefore(const Timer& left, const Timer& right);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Moves the timer at the given index in m_activeTimers up or down the heap until the heap is valid again
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void moveUpInHeap(std::size_t index);
+        static void moveDownInHeap(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stores the timer at the given index in m_activeTimers
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void placeInHeap(std::shared_ptr<Timer> timer, std::size_t index);
+
+
+        // The active timers form a binary min-heap, ordered on the time at which they have to be triggered.
+        // The deadlines are relative to m_currentTime, which is increased in each call to updateTime.
         static std::vector<std::shared_ptr<Timer>> m_activeTimers;
+        static Duration m_currentTime;
+        static std::uint64_t m_nextScheduleOrder;
+
+        static constexpr std::size_t NotScheduled = static_cast<std::size_t>(-1);
 
         bool m_repeats = false;
         bool m_enabled = false;
         Duration m_interval;
         std::function<void()> m_callback;
 
-        Duration m_remainingDuration;
+        Duration m_deadline;
+        std::uint64_t m_scheduleOrder = 0; // Timers with the same deadline are triggered in the order in which they were started
+        std::size_t m_heapIndex = NotScheduled;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -891,6 +891,24 @@ TGUI_MODULE_EXPORT namespace tgui
         virtual bool updateTime(Duration elapsedTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns whether the widget currently needs updateTime to be called, e.g. because an animation is playing.
+        /// When the gui only updates active widgets, this function is used to decide when the widget is no longer active.
+        /// @see BackendGui::setUpdateOnlyActiveWidgets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual bool isUpdateTimeRequired() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns how long the widget can wait before updateTime has to be called again, while isUpdateTimeRequired is true.
+        /// A zero duration (the default) means that the widget has to be updated every frame.
+        /// @see BackendGui::setEventDrivenMainLoop
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual Duration getTimeUntilNextUpdate() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
         /// @return Is the mouse on top of the widget?
@@ -1094,10 +1112,23 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @brief Function called when one of the properties of the renderer is changed
         ///
         /// @param property  Name of the property that was changed
+        ///
+        /// The default implementation looks up the id of the property and calls rendererPropertyChanged with it.
+        /// Custom widgets can override either this function or rendererPropertyChanged.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void rendererChanged(const String& property);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Function called when one of the properties of the renderer is changed
+        ///
+        /// @param property  Id of the property that was changed
+        ///
+        /// @throw Exception when the widget doesn't have the property
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void rendererPropertyChanged(RendererPropertyId property);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Saves the widget as a tree node in order to save it to a file
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1122,6 +1153,15 @@ TGUI_MODULE_EXPORT namespace tgui
         virtual void mouseLeftWidget();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the gui that the widget may have become active and needs its updateTime function to be called
+        ///
+        /// This function has to be called when isUpdateTimeRequired() may have changed from false to true. It does nothing
+        /// when isUpdateTimeRequired() returns false or when the widget wasn't added to a gui yet.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void requestTimeUpdates();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
 
@@ -1212,6 +1252,9 @@ TGUI_MODULE_EXPORT namespace tgui
         // This is set to true for widgets that store other widgets inside them
         bool m_containerWidget = false;
 
+        // This is set to false for widgets that can react to the mouse outside of their size (e.g. the text next to a radio button)
+        bool m_hitAreaLimitedToSize = true;
+
         // The tool tip connected to the widget
         Widget::Ptr m_toolTip = nullptr;
 
@@ -55,6 +55,7 @@ TGUI_MODULE_EXPORT namespace tgui
         {
             Text text;
             String string;
+            double top = 0; // Sum of the heights of the lines before it, relative to an arbitrary origin. A double keeps it exact in long chats.
         };
 
 
@@ -206,6 +207,28 @@ TGUI_MODULE_EXPORT namespace tgui
         void removeAllLines();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts a batch of changes to the lines
+        ///
+        /// Until endUpdate is called, adding and removing lines no longer updates the scrollbar after every call. This is done
+        /// once when the batch ends. Calls can be nested, the batch only ends when endUpdate has been called as often as
+        /// beginUpdate.
+        ///
+        /// The scrollbar isn't updated while the batch is active, so the chat box shouldn't be drawn in between.
+        ///
+        /// @see endUpdate
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void beginUpdate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Ends a batch of changes that was started with beginUpdate and updates the scrollbar
+        ///
+        /// @see beginUpdate
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void endUpdate();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the amount of lines in the chat box
         ///
@@ -384,11 +407,17 @@ TGUI_MODULE_EXPORT namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Recalculates the space used by all the lines
+        // Recalculates the positions of all lines and the space used by them
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateFullTextHeight();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the space used by the lines from the positions of the first and last line, after lines were added or removed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateFullTextHeight();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Updates the position of the lines
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -417,10 +446,10 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
-        /// @param property  Name of the property that was changed
+        /// @param property  Id of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const String& property) override;
+        void rendererPropertyChanged(RendererPropertyId property) override;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -463,6 +492,9 @@ TGUI_MODULE_EXPORT namespace tgui
 
         float m_fullTextHeight = 0;
 
+        unsigned int m_updateBatchDepth = 0; // Amount of beginUpdate calls without a matching endUpdate
+        bool m_fullTextHeightNeedsUpdate = false;
+
         bool m_linesStartFromTop = false;
         bool m_newLinesBelowOthers = true;
 
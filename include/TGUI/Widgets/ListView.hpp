@@ -354,6 +354,28 @@ TGUI_MODULE_EXPORT namespace tgui
         void removeAllItems();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts a batch of changes to the items
+        ///
+        /// Until endUpdate is called, adding, inserting, changing and removing items no longer recalculates the width of the
+        /// widest item or the maximum of the scrollbars after every call. This is all done once when the batch ends.
+        /// Calls can be nested, the batch only ends when endUpdate has been called as often as beginUpdate.
+        ///
+        /// The scrollbars aren't updated while the batch is active, so the list view shouldn't be drawn in between.
+        ///
+        /// @see endUpdate
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void beginUpdate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Ends a batch of changes that was started with beginUpdate and updates the scrollbars
+        ///
+        /// @see beginUpdate
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void endUpdate();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Selects an item in the list view
         ///
@@ -518,8 +540,8 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Sort items
         ///
-        /// @param index The index of the column for sorting
-        /// @param cmp   The comparator
+        /// @param index  The index of the column for sorting
+        /// @param cmp    The comparator
         ///
         /// Example:
         /// @code
@@ -529,6 +551,51 @@ TGUI_MODULE_EXPORT namespace tgui
         void sort(std::size_t index, const std::function<bool(const String&, const String&)>& cmp);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sort items while spreading the work over multiple threads
+        ///
+        /// @param index  The index of the column for sorting
+        /// @param cmp    The comparator, which must be safe to call from several threads at once
+        ///
+        /// The result is the same as when calling sort(). Only large lists are actually split over multiple threads.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void sortParallel(std::size_t index, const std::function<bool(const String&, const String&)>& cmp);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sort items based on a numeric key that is calculated for each cell in the column
+        ///
+        /// @param index     The index of the column for sorting
+        /// @param keyFunc   Function that converts the contents of a cell to its sort key (e.g. a number or a timestamp)
+        /// @param ascending Should the items with the smallest key be placed at the top?
+        /// @param parallel  Should the sorting be spread over multiple threads? Only large lists are actually split.
+        ///
+        /// The key function is called exactly once per item, which makes this function a lot faster than sort() when
+        /// converting the text is expensive. Items with equal keys keep their relative order. The key function may not return NaN.
+        ///
+        /// Example:
+        /// @code
+        /// listView->sortByKey(1, [](const tgui::String& cell) { return cell.toFloat(); }, false);
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void sortByKey(std::size_t index, const std::function<double(const String&)>& keyFunc, bool ascending = true, bool parallel = false);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Keeps the items sorted when new items are added
+        ///
+        /// @param index The index of the column for sorting
+        /// @param cmp   The comparator, or nullptr to stop sorting new items
+        ///
+        /// The items are sorted immediately when calling this function. Afterwards, addItem and addMultipleItems will insert the
+        /// new items at their sorted position instead of at the bottom of the list. Items passed to insertItem or modified with
+        /// changeItem or changeSubItem are placed at the requested location, they don't get sorted automatically.
+        /// Auto-sorting always happens on the calling thread, use sort or sortByKey with the parallel parameter to sort a large
+        /// list on multiple threads before enabling it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setAutoSort(std::size_t index, const std::function<bool(const String&, const String&)>& cmp);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the height of the items in the list view
         ///
@@ -856,9 +923,9 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
-        /// @param property  Name of the property that was changed
+        /// @param property  Id of the property that was changed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const String& property) override;
+        void rendererPropertyChanged(RendererPropertyId property) override;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -971,6 +1038,36 @@ TGUI_MODULE_EXPORT namespace tgui
         bool updateLastColumnMaxItemWidthWithNewItem(const Item& item);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Sorts the items with a comparator, optionally spreading the work over multiple threads
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void sortWithComparator(std::size_t index, const std::function<bool(const String&, const String&)>& cmp, bool parallel);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Reorders the items so that the item at index order[i] ends up at index i, while keeping the selection intact
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void applyItemOrder(const std::vector<std::size_t>& order);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Moves the last items to their sorted position when auto-sort is enabled. Returns the new index of the last added item.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t moveAddedItemsToSortedPosition(std::size_t addedItemCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Scrolls to an added item when auto-scrolling is enabled. During a batch update this is postponed until endUpdate.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void autoScrollToItem(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Scrolls to the bottom when auto-scrolling is enabled. During a batch update this is postponed until endUpdate.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void autoScrollToBottom();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Update the maximum item width of the last column based on the modification of an Item.
         // Returns true if the maximum item width was changed.
@@ -1058,6 +1155,12 @@ TGUI_MODULE_EXPORT namespace tgui
         bool updateTime(Duration elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the widget currently needs updateTime to be called
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isUpdateTimeRequired() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1119,6 +1222,17 @@ TGUI_MODULE_EXPORT namespace tgui
         int m_possibleDoubleClick = false; // Will be set to true after the first click, but gets reset to false when the second click does not occur soon after
         bool m_autoScroll = true; // Should the list view scroll to the bottom when a new item is added?
 
+        unsigned int m_updateBatchDepth = 0; // Amount of beginUpdate calls without a matching endUpdate
+        bool m_lastColumnMaxItemWidthNeedsUpdate = false;
+        bool m_horizontalScrollbarMaximumNeedsUpdate = false;
+        bool m_verticalScrollbarMaximumNeedsUpdate = false;
+        bool m_autoScrollToItemNeedsUpdate = false;
+        bool m_autoScrollToBottomNeedsUpdate = false;
+        std::size_t m_autoScrollItemIndex = 0; // Item to scroll to at the end of the batch when m_autoScrollToItemNeedsUpdate is set
+
+        std::size_t m_autoSortColumn = 0;
+        std::function<bool(const String&, const String&)> m_autoSortCmp; // Keeps new items sorted when set
+
         Sprite m_spriteHeaderBackground;
         Sprite m_spriteBackground;
 
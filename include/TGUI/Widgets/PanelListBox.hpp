@@ -29,6 +29,10 @@
 #include <TGUI/Widgets/ScrollablePanel.hpp>
 #include <TGUI/Renderers/PanelListBoxRenderer.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <functional>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 TGUI_MODULE_EXPORT namespace tgui
@@ -45,6 +49,9 @@ TGUI_MODULE_EXPORT namespace tgui
 
         static constexpr const char StaticWidgetType[] = "PanelListBox"; //!< Type name of the widget
 
+        using CreateItemFunc = std::function<Panel::Ptr()>; //!< Creates a new panel for recycling mode
+        using BindItemFunc = std::function<void(const Panel::Ptr& panel, std::size_t index)>; //!< Makes a panel show the item with the given index
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
@@ -56,6 +63,30 @@ TGUI_MODULE_EXPORT namespace tgui
         PanelListBox(const char* typeName = StaticWidgetType, bool initRenderer = true);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copy constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PanelListBox(const PanelListBox& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Move constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PanelListBox(PanelListBox&& other) noexcept;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Overload of assignment operator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PanelListBox& operator= (const PanelListBox& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Overload of move assignment operator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PanelListBox& operator= (PanelListBox&& other) noexcept;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Creates a new panel list box widget
         /// @return The new panel list box
@@ -99,11 +130,65 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @brief Adds an item to the list
         /// @param id Optional unique id given to this item for the purpose to later identifying this item
         /// @param index Optional index at which new item will be added. If not provided, item will be added at last position
-        /// @return Pointer to newly created panel
+        /// @return Pointer to newly created panel, or nullptr when the maximum amount of items was reached or the list box
+        ///         is in recycling mode
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Panel::Ptr addItem(const String& id = {}, int index = -1);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Shows items that aren't stored in the list box, by reusing only a few panels (recycling mode)
+        ///
+        /// Instead of having a panel for every item, the list box only creates enough panels to fill its visible area.
+        /// When scrolling, the panels that leave the visible area are reused for the items that scroll into view. The bind
+        /// function is called each time a panel starts showing a different item and should update the contents of the panel.
+        ///
+        /// Items that were added with addItem are removed. While in recycling mode, addItem and the functions to remove items
+        /// have no effect, setRecycledItemCount has to be called when the amount of items changes. Items don't have ids and
+        /// getItemByIndex returns a nullptr for items that are outside the visible area. Call removeAllItems to leave this mode.
+        ///
+        /// @param itemCount   Amount of items in the list
+        /// @param bindItem    Function that makes a panel show the item with the given index
+        /// @param createItem  Function that creates a new panel. Copies of the panel template are used when it isn't provided.
+        ///
+        /// Example usage:
+        /// @code
+        /// listBox->setRecyclingMode(messages.size(), [&](const tgui::Panel::Ptr& panel, std::size_t index) {
+        ///     panel->get<tgui::Label>("Text")->setText(messages[index]);
+        /// });
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRecyclingMode(std::size_t itemCount, const BindItemFunc& bindItem, const CreateItemFunc& createItem = nullptr);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the list box is in recycling mode
+        ///
+        /// @return Was setRecyclingMode called without calling removeAllItems afterwards?
+        ///
+        /// @see setRecyclingMode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isRecyclingMode() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the amount of items when the list box is in recycling mode
+        ///
+        /// @param itemCount  Amount of items in the list
+        ///
+        /// All visible panels are bound again, as the items they show might have moved to a different index.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRecycledItemCount(std::size_t itemCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calls the bind function again for all visible items when the list box is in recycling mode
+        ///
+        /// This function should be called when the data of the items changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void refreshRecycledItems();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Get panel template from which new elements are created
         ///
@@ -446,10 +531,10 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
-        /// @param property  Name of the property that was changed
+        /// @param property  Id of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const String& property) override;
+        void rendererPropertyChanged(RendererPropertyId property) override;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -465,9 +550,9 @@ TGUI_MODULE_EXPORT namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Updates the position of the items
+        // Updates the position of the items, starting from the given index
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void updateItemsPositions() const;
+        void updateItemsPositions(std::size_t firstIndex = 0) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -476,6 +561,25 @@ TGUI_MODULE_EXPORT namespace tgui
         void updateItemsSize() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes the panels in recycling mode show the items that are inside the visible area.
+        // Panels are only bound again when they show a different item, unless rebindAll is true.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateRecycledPanels(bool rebindAll = false);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the recycled panels when the list box is scrolled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void connectVerticalScrollbar();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // After the child widgets were copied, let the items refer to the copied panels instead of the panels in the original
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void copyItemPanels(const PanelListBox& other);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Returns all items height
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -542,10 +646,23 @@ TGUI_MODULE_EXPORT namespace tgui
             String id;
         };
 
+        struct RecycledPanel
+        {
+            Panel::Ptr panel;
+            std::size_t index; // Index of the item shown by the panel, or std::numeric_limits<std::size_t>::max() when unused
+        };
+
         std::vector<Item> m_items;
         std::size_t m_maxItems;
         Panel::Ptr m_panelTemplate;
 
+        // The item with index i is always shown by m_recycledPanels[i % m_recycledPanels.size()] in recycling mode
+        bool m_recyclingMode = false;
+        std::size_t m_recycledItemCount = 0;
+        std::vector<RecycledPanel> m_recycledPanels;
+        BindItemFunc m_bindItemFunc;
+        CreateItemFunc m_createItemFunc;
+
         int m_selectedItem;
         int m_hoveringItem;
 
@@ -32,6 +32,10 @@
 #include <TGUI/Renderers/TextAreaRenderer.hpp>
 #include <TGUI/Text.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <deque>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 TGUI_MODULE_EXPORT namespace tgui
@@ -457,7 +461,7 @@ TGUI_MODULE_EXPORT namespace tgui
         void updateScrollbars();
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // This function will split the text into five pieces so that the text can be easily drawn.
+        // Updates the caret and the text objects after the selection changed.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateSelectionTexts();
 
@@ -548,6 +552,18 @@ TGUI_MODULE_EXPORT namespace tgui
         bool updateTime(Duration elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the widget currently needs updateTime to be called
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isUpdateTimeRequired() const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns how long the widget can wait before it has to be updated again
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Duration getTimeUntilNextUpdate() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Recalculates the positions of the contents of the text area.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -560,6 +576,13 @@ TGUI_MODULE_EXPORT namespace tgui
         void recalculateVisibleLines();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates or updates the text objects of the lines near the visible area.
+        // Lines that are further away don't have text objects, so drawing doesn't depend on the length of the text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateLineTexts();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Retrieves a signal based on its name
         ///
@@ -575,10 +598,10 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
-        /// @param property  Name of the property that was changed
+        /// @param property  Id of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const String& property) override;
+        void rendererPropertyChanged(RendererPropertyId property) override;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -639,14 +662,31 @@ TGUI_MODULE_EXPORT namespace tgui
         Vector2f m_caretPosition;
         bool m_caretVisible = true;
 
-        Text m_textBeforeSelection;
-        Text m_textSelection1;
-        Text m_textSelection2;
-        Text m_textAfterSelection1;
-        Text m_textAfterSelection2;
-        Text m_defaultText;
+        // Part of a line that is selected
+        struct LineSelection
+        {
+            std::size_t start = 0;
+            std::size_t end = 0;
+            bool continuesAbove = false; // Is the previous line also part of the selection?
+            bool continuesBelow = false; // Is the next line also part of the selection?
+        };
+
+        // Text objects of a single line, split in the parts before, inside and after the selection
+        struct LineTexts
+        {
+            Text textBeforeSelection;
+            Text textSelection;
+            Text textAfterSelection;
+            FloatRect selectionRect;
+            LineSelection selection;
+            bool needsUpdate = true;
+        };
+
+        // Only the lines near the visible area have text objects, the first one belongs to the line at m_lineTextsStartLine
+        std::deque<LineTexts> m_lineTexts;
+        std::size_t m_lineTextsStartLine = 0;
 
-        std::vector<FloatRect> m_selectionRects;
+        Text m_defaultText;
 
         // The scrollbars
         CopiedSharedPtr<ScrollbarChildWidget> m_verticalScrollbar;
@@ -670,6 +710,8 @@ TGUI_MODULE_EXPORT namespace tgui
         Color   m_backgroundColorCached;
         Color   m_caretColorCached;
         Color   m_selectedTextBackgroundColorCached;
+        Color   m_textColorCached;
+        Color   m_selectedTextColorCached;
         float   m_caretWidthCached = 1;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
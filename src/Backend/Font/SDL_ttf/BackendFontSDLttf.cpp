@@ -316,6 +316,7 @@ namespace tgui
         }
 
         m_texture = getBackend()->getRenderer()->createTexture();
+        m_texture->setMipmapsAllowed(false);
         m_texture->loadTextureOnly({m_textureSize, m_textureSize}, m_pixels.get(), m_isSmooth);
 
         textureVersion = ++m_textureVersion;
@@ -196,6 +196,7 @@ namespace tgui
         // texture with TGUI, even if the TGUI texture also uses sf::Texture.
         const sf::Image& image = m_font.getTexture(scaledTextSize).copyToImage();
         auto texture = getBackend()->getRenderer()->createTexture();
+        texture->setMipmapsAllowed(false);
         texture->loadTextureOnly({image.getSize().x, image.getSize().y}, image.getPixelsPtr(), m_isSmooth);
         m_textures[scaledTextSize] = texture;
 
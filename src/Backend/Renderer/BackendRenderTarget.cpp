@@ -324,6 +324,10 @@ namespace tgui
         if (!sprite.isSet())
             return;
 
+        // Textures that are still being loaded in the background are treated as being fully transparent
+        if (sprite.getTexture().isLoading())
+            return;
+
         RenderStates transformedStates = states;
         if (sprite.getRotation() != 0)
         {
@@ -342,6 +346,8 @@ namespace tgui
         std::shared_ptr<BackendTexture> backendTexture;
         if (sprite.getTexture().getData()->svgImage)
             backendTexture = sprite.getSvgTexture();
+        else if (sprite.getDownscaledTexture())
+            backendTexture = sprite.getDownscaledTexture();
         else
             backendTexture = sprite.getTexture().getData()->backendTexture;
 
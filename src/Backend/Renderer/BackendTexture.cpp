@@ -25,10 +25,42 @@
 
 #include <TGUI/Backend/Renderer/BackendTexture.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <cstring>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Sets the bits in the alpha mask for the transparent pixels in the given part of the image
+        void updateAlphaMask(std::uint8_t* alphaMask, unsigned int imageWidth, const UIntRect& rect, const std::uint8_t* pixels)
+        {
+            const unsigned int bytesPerRow = (imageWidth + 7) / 8;
+            for (unsigned int y = 0; y < rect.height; ++y)
+            {
+                std::uint8_t* maskRow = &alphaMask[(rect.top + y) * bytesPerRow];
+                for (unsigned int x = 0; x < rect.width; ++x)
+                {
+                    const unsigned int maskX = rect.left + x;
+                    const auto bit = static_cast<std::uint8_t>(1 << (maskX % 8));
+                    if (pixels[((y * rect.width) + x) * 4 + 3] == 0)
+                        maskRow[maskX / 8] |= bit;
+                    else
+                        maskRow[maskX / 8] &= static_cast<std::uint8_t>(~bit);
+                }
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendTexture::PixelStorage BackendTexture::m_defaultPixelStorage = BackendTexture::PixelStorage::Full;
+    std::size_t BackendTexture::m_uploadBudget = 4 * 1024 * 1024;
+    std::size_t BackendTexture::m_uploadedByteCount = 0;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool BackendTexture::load(Vector2u size, std::unique_ptr<std::uint8_t[]> pixels, bool smooth)
@@ -38,17 +70,28 @@ namespace tgui
         if (!loadTextureOnly(size, pixels.get(), smooth))
             return false;
 
-        m_pixels = std::move(pixels);
+        if (m_pixelStorage == PixelStorage::Full)
+            m_pixels = std::move(pixels);
+        else if (m_pixelStorage == PixelStorage::AlphaMask)
+        {
+            m_alphaMask = std::make_unique<std::uint8_t[]>(static_cast<std::size_t>((size.x + 7) / 8) * size.y);
+            updateAlphaMask(m_alphaMask.get(), size.x, {0, 0, size.x, size.y}, pixels.get());
+        }
+
         return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool BackendTexture::loadTextureOnly(Vector2u size, const std::uint8_t*, bool smooth)
+    bool BackendTexture::loadTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth)
     {
         TGUI_ASSERT((size.x > 0) && (size.y > 0), "load and loadTextureOnly functions in BackendTexture needs a valid size");
 
+        if (pixels)
+            m_uploadedByteCount += 4 * static_cast<std::size_t>(size.x) * size.y;
+
         m_pixels = nullptr;
+        m_alphaMask = nullptr;
         m_imageSize = size;
         m_isSmooth = smooth;
         return true;
@@ -56,6 +99,41 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTexture::update(const UIntRect& rect, const std::uint8_t* pixels)
+    {
+        TGUI_ASSERT((rect.left + rect.width <= m_imageSize.x) && (rect.top + rect.height <= m_imageSize.y), "BackendTexture::update called with rect outside texture");
+
+        if (m_pixels)
+        {
+            for (unsigned int y = 0; y < rect.height; ++y)
+            {
+                std::memcpy(&m_pixels[((rect.top + y) * m_imageSize.x + rect.left) * 4],
+                            &pixels[y * rect.width * 4],
+                            rect.width * 4);
+            }
+        }
+        else if (m_alphaMask)
+            updateAlphaMask(m_alphaMask.get(), m_imageSize.x, rect, pixels);
+
+        return updateTextureOnly(rect, pixels);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTexture::updateTextureOnly(const UIntRect&, const std::uint8_t*)
+    {
+        if (!m_pixels)
+            return false;
+
+        // Upload the entire image again. The pixels have to be moved out temporarily, as loadTextureOnly clears them.
+        auto pixels = std::move(m_pixels);
+        const bool success = loadTextureOnly(m_imageSize, pixels.get(), m_isSmooth);
+        m_pixels = std::move(pixels);
+        return success;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2u BackendTexture::getSize() const
     {
         return m_imageSize;
@@ -79,13 +157,21 @@ namespace tgui
 
     bool BackendTexture::isTransparentPixel(Vector2u pixel) const
     {
-        if (!m_pixels)
+        if (!m_pixels && !m_alphaMask)
             return false;
 
         TGUI_ASSERT((pixel.x < m_imageSize.x) && (pixel.y < m_imageSize.y), "Pixel out of range in BackendTexture::isTransparentPixel");
 
-        const auto pixelOffset = (pixel.y * m_imageSize.x + pixel.x) * 4;
-        return (m_pixels[pixelOffset + 3] == 0);
+        if (m_pixels)
+        {
+            const auto pixelOffset = (pixel.y * m_imageSize.x + pixel.x) * 4;
+            return (m_pixels[pixelOffset + 3] == 0);
+        }
+        else
+        {
+            const unsigned int bytesPerRow = (m_imageSize.x + 7) / 8;
+            return ((m_alphaMask[pixel.y * bytesPerRow + pixel.x / 8] & (1 << (pixel.x % 8))) != 0);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -96,6 +182,83 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTexture::setPixelStorage(PixelStorage storage)
+    {
+        m_pixelStorage = storage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendTexture::PixelStorage BackendTexture::getPixelStorage() const
+    {
+        return m_pixelStorage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTexture::setMipmapsAllowed(bool allowed)
+    {
+        m_mipmapsAllowed = allowed;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTexture::getMipmapsAllowed() const
+    {
+        return m_mipmapsAllowed;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTexture::setDefaultPixelStorage(PixelStorage storage)
+    {
+        m_defaultPixelStorage = storage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendTexture::PixelStorage BackendTexture::getDefaultPixelStorage()
+    {
+        return m_defaultPixelStorage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTexture::setUploadBudget(std::size_t bytesPerFrame)
+    {
+        m_uploadBudget = bytesPerFrame;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendTexture::getUploadBudget()
+    {
+        return m_uploadBudget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendTexture::getUploadedByteCount()
+    {
+        return m_uploadedByteCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTexture::resetUploadedByteCount()
+    {
+        m_uploadedByteCount = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTexture::isWithinUploadBudget(std::size_t byteCount)
+    {
+        return (m_uploadedByteCount <= m_uploadBudget) && (byteCount <= m_uploadBudget - m_uploadedByteCount);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
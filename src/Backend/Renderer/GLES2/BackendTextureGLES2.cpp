@@ -32,10 +32,35 @@
     #include <TGUI/Backend/Window/Backend.hpp>
 #endif
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Amount of levels needed to go from the full size down to 1x1 pixel
+        TGUI_NODISCARD GLsizei getMipmapLevelCount(Vector2u size)
+        {
+            GLsizei levels = 1;
+            for (unsigned int maxSize = std::max(size.x, size.y); maxSize > 1; maxSize /= 2)
+                ++levels;
+            return levels;
+        }
+
+        TGUI_NODISCARD bool isPowerOfTwo(unsigned int value)
+        {
+            return (value != 0) && ((value & (value - 1)) == 0);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextureGLES2::m_mipmapsEnabled = false;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     BackendTextureGLES2::~BackendTextureGLES2()
@@ -51,9 +76,13 @@ namespace tgui
         TGUI_ASSERT(isBackendSet(), "BackendTextureGLES2 can't be created when there is no system backend initialized (was a gui created yet?)");
         TGUI_ASSERT(getBackend()->getRenderer(), "BackendTextureGLES2 can't be created when there is no backend renderer (was a gui attached to a window yet?)");
 
-        const bool reuseTexture = ((m_textureId != 0) && (size.x == m_imageSize.x) && (size.y == m_imageSize.y) && (smooth == m_isSmooth));
+        // OpenGL ES 2.0 can only generate mipmaps for textures with a power-of-two size
+        const bool useMipmaps = m_mipmapsEnabled && m_mipmapsAllowed && (TGUI_GLAD_GL_ES_VERSION_3_0 || (isPowerOfTwo(size.x) && isPowerOfTwo(size.y)));
+        const bool reuseTexture = ((m_textureId != 0) && (size.x == m_imageSize.x) && (size.y == m_imageSize.y) && (smooth == m_isSmooth)
+                                && (useMipmaps == m_hasMipmaps));
 
         BackendTexture::loadTextureOnly(size, pixels, smooth);
+        m_hasMipmaps = useMipmaps;
 
         if (!reuseTexture)
         {
@@ -76,24 +105,50 @@ namespace tgui
         else
         {
             TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, smooth ? GL_LINEAR : GL_NEAREST));
-            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, smooth ? GL_LINEAR : GL_NEAREST));
+            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, getMinFilter()));
 
             TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT));
             TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT));
 
             if (TGUI_GLAD_GL_ES_VERSION_3_0)
             {
-                TGUI_GL_CHECK(glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y)));
+                const GLsizei levels = m_hasMipmaps ? getMipmapLevelCount(size) : 1;
+                TGUI_GL_CHECK(glTexStorage2D(GL_TEXTURE_2D, levels, GL_RGBA8, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y)));
                 if (pixels)
                     TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), GL_RGBA, GL_UNSIGNED_BYTE, pixels));
             }
             else
             {
-                // GLES 2.0 doesn't support GL_RGBA8
+                // GLES 2.0 doesn't support GL_RGBA8. The mipmap levels are allocated by glGenerateMipmap.
                 TGUI_GL_CHECK(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels));
             }
         }
 
+        if (m_hasMipmaps)
+            TGUI_GL_CHECK(glGenerateMipmap(GL_TEXTURE_2D));
+
+        // Restore the texture that was bound when this function was called
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(oldBoundTexture)));
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextureGLES2::updateTextureOnly(const UIntRect& rect, const std::uint8_t* pixels)
+    {
+        if (!m_textureId)
+            return false;
+
+        GLint oldBoundTexture;
+        TGUI_GL_CHECK(glGetIntegerv(GL_TEXTURE_BINDING_2D, &oldBoundTexture));
+
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_textureId));
+        TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, static_cast<GLint>(rect.left), static_cast<GLint>(rect.top),
+                                      static_cast<GLsizei>(rect.width), static_cast<GLsizei>(rect.height), GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+        m_uploadedByteCount += 4 * static_cast<std::size_t>(rect.width) * rect.height;
+        if (m_hasMipmaps)
+            TGUI_GL_CHECK(glGenerateMipmap(GL_TEXTURE_2D));
+
         // Restore the texture that was bound when this function was called
         TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(oldBoundTexture)));
         return true;
@@ -116,7 +171,7 @@ namespace tgui
 
         TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_textureId));
         TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
-        TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
+        TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, getMinFilter()));
 
         // Restore the texture that was bound when this function was called
         TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(oldBoundTexture)));
@@ -130,6 +185,39 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTextureGLES2::setMipmapsEnabled(bool enabled)
+    {
+        m_mipmapsEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextureGLES2::getMipmapsEnabled()
+    {
+        return m_mipmapsEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextureGLES2::hasMipmaps() const
+    {
+        return m_hasMipmaps;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int BackendTextureGLES2::getMinFilter() const
+    {
+        if (!m_isSmooth)
+            return GL_NEAREST;
+        else if (m_hasMipmaps)
+            return GL_LINEAR_MIPMAP_LINEAR;
+        else
+            return GL_LINEAR;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
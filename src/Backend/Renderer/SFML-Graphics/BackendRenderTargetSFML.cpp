@@ -94,7 +94,7 @@ namespace tgui
 
     void BackendRenderTargetSFML::drawSprite(const RenderStates& states, const Sprite& sprite)
     {
-        if (!sprite.isSet())
+        if (!sprite.isSet() || sprite.getTexture().isLoading())
             return;
 
         // We can use the drawVertexArray function (called from the base class) if the sprite doesn't have a shader
@@ -193,8 +193,8 @@ namespace tgui
 
     void CanvasSFML::draw(const tgui::Sprite& sprite, const RenderStates& states)
     {
-        // If the sprite is empty then don't try to draw it
-        if (!sprite.getTexture().getData())
+        // If the sprite is empty or its image is still being loaded then don't try to draw it
+        if (!sprite.getTexture().getData() || sprite.getTexture().isLoading())
             return;
 
         const std::vector<Vertex>& vertices = sprite.getVertices();
@@ -26,12 +26,32 @@
 #include <TGUI/Backend/Window/Backend.hpp>
 #include <TGUI/Backend/Renderer/BackendRenderTarget.hpp>
 #include <TGUI/ToolTip.hpp>
+#include <TGUI/TextureManager.hpp>
+#include <TGUI/SvgImage.hpp>
 #include <TGUI/Timer.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    // Returns whether the widget and all of its parents are visible
+    TGUI_NODISCARD static bool isWidgetVisibleInGui(const Widget* widget)
+    {
+        while (widget)
+        {
+            if (!widget->isVisible())
+                return false;
+
+            widget = widget->getParent();
+        }
+
+        return true;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     BackendGui::BackendGui()
@@ -103,66 +123,39 @@ namespace tgui
 
     bool BackendGui::handleEvent(Event event)
     {
+        if (event.type == Event::Type::MouseMoved)
+        {
+            const Vector2i mousePos{event.mouseMove.x, event.mouseMove.y};
+            if (m_mouseMoveCoalescing)
+            {
+                if (m_mouseMoveHistoryEnabled)
+                    m_pendingMouseMoveHistory.push_back(mapPixelToCoords(mousePos));
+
+                // The last mouse position is updated immediately, as backends use it to fill in the position of other events
+                m_lastMousePos = mousePos;
+                m_pendingMouseMove = mousePos;
+                return false;
+            }
+
+            if (m_mouseMoveHistoryEnabled)
+            {
+                m_mouseMoveHistory.clear();
+                m_mouseMoveHistory.push_back(mapPixelToCoords(mousePos));
+            }
+        }
+        else if (m_pendingMouseMove)
+        {
+            // The widgets have to know the latest mouse position before we can pass them any other event
+            processPendingMouseMove();
+        }
+
         switch (event.type)
         {
             case Event::Type::MouseMoved:
             case Event::Type::MouseButtonPressed:
             case Event::Type::MouseButtonReleased:
             case Event::Type::MouseWheelScrolled:
-            {
-                Vector2f mouseCoords;
-                if (event.type == Event::Type::MouseMoved)
-                {
-                    m_lastMousePos = {event.mouseMove.x, event.mouseMove.y};
-                    mouseCoords = mapPixelToCoords({event.mouseMove.x, event.mouseMove.y});
-                }
-                else if (event.type == Event::Type::MouseWheelScrolled)
-                {
-                    m_lastMousePos = {event.mouseWheel.x, event.mouseWheel.y};
-                    mouseCoords = mapPixelToCoords({event.mouseWheel.x, event.mouseWheel.y});
-                }
-                else // if ((event.type == Event::Type::MouseButtonPressed) || (event.type == Event::Type::MouseButtonReleased))
-                {
-                    m_lastMousePos = {event.mouseButton.x, event.mouseButton.y};
-                    mouseCoords = mapPixelToCoords({event.mouseButton.x, event.mouseButton.y});
-                }
-
-                // If a tooltip is visible then hide it now
-                if (m_visibleToolTip != nullptr)
-                {
-                    // Correct the position of the tool tip so that it is relative again
-                    m_visibleToolTip->setPosition(m_toolTipRelativePos);
-
-                    remove(m_visibleToolTip);
-                    m_visibleToolTip = nullptr;
-                }
-
-                // Reset the data for the tooltip since the mouse has moved
-                m_tooltipTime = {};
-                m_tooltipPossible = true;
-
-                if (event.type == Event::Type::MouseMoved)
-                    return m_container->processMouseMoveEvent(mouseCoords);
-                else if (event.type == Event::Type::MouseWheelScrolled)
-                {
-                    if (m_container->processScrollEvent(event.mouseWheel.delta, mouseCoords, false))
-                        return true;
-
-                    // Even if no scrollbar moved, we will still absorb the scroll event when the mouse is on top of a widget
-                    return m_container->getWidgetAtPosition(mouseCoords) != nullptr;
-                }
-                else if (event.type == Event::Type::MouseButtonPressed)
-                    return m_container->processMousePressEvent(event.mouseButton.button, mouseCoords);
-                else // if (event.type == Event::Type::MouseButtonReleased)
-                {
-                    const bool eventHandled = m_container->processMouseReleaseEvent(event.mouseButton.button, mouseCoords);
-                    if (event.mouseButton.button == Event::MouseButton::Left)
-                        m_container->leftMouseButtonNoLongerDown();
-                    else if (event.mouseButton.button == Event::MouseButton::Right)
-                        m_container->rightMouseButtonNoLongerDown();
-                    return eventHandled;
-                }
-            }
+                return handleMouseEvent(event);
             case Event::Type::KeyPressed:
             {
                 if (isTabKeyUsageEnabled() && (event.key.code == Event::KeyboardKey::Tab))
@@ -208,6 +201,64 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendGui::handleMouseEvent(const Event& event)
+    {
+        Vector2f mouseCoords;
+        if (event.type == Event::Type::MouseMoved)
+        {
+            m_lastMousePos = {event.mouseMove.x, event.mouseMove.y};
+            mouseCoords = mapPixelToCoords({event.mouseMove.x, event.mouseMove.y});
+        }
+        else if (event.type == Event::Type::MouseWheelScrolled)
+        {
+            m_lastMousePos = {event.mouseWheel.x, event.mouseWheel.y};
+            mouseCoords = mapPixelToCoords({event.mouseWheel.x, event.mouseWheel.y});
+        }
+        else // if ((event.type == Event::Type::MouseButtonPressed) || (event.type == Event::Type::MouseButtonReleased))
+        {
+            m_lastMousePos = {event.mouseButton.x, event.mouseButton.y};
+            mouseCoords = mapPixelToCoords({event.mouseButton.x, event.mouseButton.y});
+        }
+
+        // If a tooltip is visible then hide it now
+        if (m_visibleToolTip != nullptr)
+        {
+            // Correct the position of the tool tip so that it is relative again
+            m_visibleToolTip->setPosition(m_toolTipRelativePos);
+
+            remove(m_visibleToolTip);
+            m_visibleToolTip = nullptr;
+        }
+
+        // Reset the data for the tooltip since the mouse has moved
+        m_tooltipTime = {};
+        m_tooltipPossible = true;
+
+        if (event.type == Event::Type::MouseMoved)
+            return m_container->processMouseMoveEvent(mouseCoords);
+        else if (event.type == Event::Type::MouseWheelScrolled)
+        {
+            if (m_container->processScrollEvent(event.mouseWheel.delta, mouseCoords, false))
+                return true;
+
+            // Even if no scrollbar moved, we will still absorb the scroll event when the mouse is on top of a widget
+            return m_container->getWidgetAtPosition(mouseCoords) != nullptr;
+        }
+        else if (event.type == Event::Type::MouseButtonPressed)
+            return m_container->processMousePressEvent(event.mouseButton.button, mouseCoords);
+        else // if (event.type == Event::Type::MouseButtonReleased)
+        {
+            const bool eventHandled = m_container->processMouseReleaseEvent(event.mouseButton.button, mouseCoords);
+            if (event.mouseButton.button == Event::MouseButton::Left)
+                m_container->leftMouseButtonNoLongerDown();
+            else if (event.mouseButton.button == Event::MouseButton::Right)
+                m_container->rightMouseButtonNoLongerDown();
+            return eventHandled;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendGui::setTabKeyUsageEnabled(bool enabled)
     {
         m_tabKeyUsageEnabled = enabled;
@@ -226,6 +277,8 @@ namespace tgui
     {
         if (m_drawUpdatesTime)
             updateTime();
+        else
+            processPendingMouseMove();
 
         TGUI_ASSERT(m_backendRenderTarget != nullptr, "Gui must be given a window (or render target) before calling draw()");
         m_backendRenderTarget->drawGui(m_container);
@@ -500,6 +553,11 @@ namespace tgui
         bool screenRefreshRequired = false;
         if (m_lastUpdateTime > std::chrono::steady_clock::time_point())
             screenRefreshRequired = updateTime(timePointNow - m_lastUpdateTime);
+        else if (m_pendingMouseMove)
+        {
+            processPendingMouseMove();
+            screenRefreshRequired = true;
+        }
 
         m_lastUpdateTime = timePointNow;
         return screenRefreshRequired;
@@ -509,12 +567,34 @@ namespace tgui
 
     bool BackendGui::updateTime(Duration elapsedTime)
     {
-        bool screenRefreshRequired = Timer::updateTime(elapsedTime);
+        // The screen is redrawn after a mouse move, as the mouse may have left a widget even if the event wasn't consumed
+        bool screenRefreshRequired = false;
+        if (m_pendingMouseMove)
+        {
+            processPendingMouseMove();
+            screenRefreshRequired = true;
+        }
+
+        screenRefreshRequired |= Timer::updateTime(elapsedTime);
+        // Images that aren't shown yet are uploaded before svg images that are still shown at their previous size.
+        // Everything that is uploaded after this point (e.g. while drawing) counts towards the budget of the next frame.
+        screenRefreshRequired |= TextureManager::processAsyncLoads();
+        screenRefreshRequired |= SvgImage::processBackgroundRasterizations();
+        BackendTexture::resetUploadedByteCount();
 
         if (!m_windowFocused)
+        {
+            pruneActiveWidgets();
             return screenRefreshRequired;
+        }
 
-        screenRefreshRequired |= m_container->updateTime(elapsedTime);
+        if (m_updateOnlyActiveWidgets)
+            screenRefreshRequired |= updateTimeOfActiveWidgets(elapsedTime);
+        else
+            screenRefreshRequired |= m_container->updateTime(elapsedTime);
+
+        // Widgets also register themselves when all widgets are being updated, so the list has to be pruned in both modes
+        pruneActiveWidgets();
 
         if (m_tooltipPossible)
         {
@@ -553,6 +633,233 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendGui::setUpdateOnlyActiveWidgets(bool onlyActiveWidgets)
+    {
+        m_updateOnlyActiveWidgets = onlyActiveWidgets;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::getUpdateOnlyActiveWidgets() const
+    {
+        return m_updateOnlyActiveWidgets;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::addActiveWidget(Widget* widget)
+    {
+        if (m_activeWidgetIndices.emplace(widget, m_activeWidgets.size()).second)
+            m_activeWidgets.push_back(widget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::removeActiveWidget(Widget* widget)
+    {
+        const auto it = m_activeWidgetIndices.find(widget);
+        if (it == m_activeWidgetIndices.end())
+            return;
+
+        // The size of the list isn't changed here as we might be iterating over it, the entry is removed when pruning the list
+        m_activeWidgets[it->second] = nullptr;
+        m_activeWidgetIndices.erase(it);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::updateTimeOfActiveWidgets(Duration elapsedTime)
+    {
+        bool screenRefreshRequired = false;
+
+        // Widgets that are added while looping won't be updated until the next time
+        const std::size_t activeWidgetCount = m_activeWidgets.size();
+        for (std::size_t i = 0; i < activeWidgetCount; ++i)
+        {
+            Widget* const widget = m_activeWidgets[i];
+
+            // Just like when updating all widgets, the widget isn't updated while it or one of its parents is hidden
+            if (!widget || !isWidgetVisibleInGui(widget))
+                continue;
+
+            // Keep the widget alive in case it gets removed from its parent while it is being updated
+            const Widget::Ptr widgetPtr = widget->shared_from_this();
+            screenRefreshRequired |= widget->updateTime(elapsedTime);
+        }
+
+        return screenRefreshRequired;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::pruneActiveWidgets()
+    {
+        std::size_t activeWidgetCount = 0;
+        for (Widget* const widget : m_activeWidgets)
+        {
+            if (!widget)
+                continue;
+
+            if (!widget->isUpdateTimeRequired())
+            {
+                m_activeWidgetIndices.erase(widget);
+                continue;
+            }
+
+            m_activeWidgetIndices[widget] = activeWidgetCount;
+            m_activeWidgets[activeWidgetCount++] = widget;
+        }
+
+        m_activeWidgets.resize(activeWidgetCount);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::setEventDrivenMainLoop(bool eventDriven)
+    {
+        m_eventDrivenMainLoop = eventDriven;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::getEventDrivenMainLoop() const
+    {
+        return m_eventDrivenMainLoop;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::setFrameRateLimit(unsigned int framesPerSecond)
+    {
+        m_frameRateLimit = framesPerSecond;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int BackendGui::getFrameRateLimit() const
+    {
+        return m_frameRateLimit;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::setMouseMoveCoalescing(bool coalesce)
+    {
+        m_mouseMoveCoalescing = coalesce;
+        if (!m_mouseMoveCoalescing)
+            processPendingMouseMove();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::getMouseMoveCoalescing() const
+    {
+        return m_mouseMoveCoalescing;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::setMouseMoveHistoryEnabled(bool enabled)
+    {
+        m_mouseMoveHistoryEnabled = enabled;
+        if (!m_mouseMoveHistoryEnabled)
+        {
+            m_pendingMouseMoveHistory.clear();
+            m_mouseMoveHistory.clear();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::getMouseMoveHistoryEnabled() const
+    {
+        return m_mouseMoveHistoryEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<Vector2f>& BackendGui::getMouseMoveHistory() const
+    {
+        return m_mouseMoveHistory;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::processPendingMouseMove()
+    {
+        if (!m_pendingMouseMove)
+            return false;
+
+        Event event;
+        event.type = Event::Type::MouseMoved;
+        event.mouseMove.x = m_pendingMouseMove->x;
+        event.mouseMove.y = m_pendingMouseMove->y;
+        m_pendingMouseMove.reset();
+
+        // Reuse the memory of the old history for collecting the positions of the next mouse move
+        m_mouseMoveHistory.swap(m_pendingMouseMoveHistory);
+        m_pendingMouseMoveHistory.clear();
+
+        return handleMouseEvent(event);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Optional<Duration> BackendGui::getMainLoopWaitTime() const
+    {
+        Optional<Duration> waitTime = Timer::getNextScheduledTime();
+        const auto limitWaitTime = [&waitTime](Duration maxWaitTime){
+            if (!waitTime || (maxWaitTime < *waitTime))
+                waitTime = maxWaitTime;
+        };
+
+        // Unless the main loop is event-driven, we check for events at least every 10ms
+        if (!m_eventDrivenMainLoop)
+        {
+            limitWaitTime(std::chrono::milliseconds(10));
+            return waitTime;
+        }
+
+        // Widgets that are playing an animation need to be updated every frame, while e.g. a focused text field only needs to
+        // be updated when its caret blinks. The list of active widgets is only pruned when updating the time, so we have to
+        // check whether the registered widgets still need to be updated.
+        if (m_windowFocused)
+        {
+            const Duration frameDuration = getMainLoopFrameDuration();
+            for (const Widget* widget : m_activeWidgets)
+            {
+                if (widget && widget->isUpdateTimeRequired() && isWidgetVisibleInGui(widget))
+                    limitWaitTime(std::max(frameDuration, widget->getTimeUntilNextUpdate()));
+            }
+        }
+
+        // Images that are being decoded or rasterized in the background have to be uploaded once they are ready
+        if ((TextureManager::getAsyncLoadCount() > 0) || (SvgImage::getBackgroundRasterizationCount() > 0))
+            limitWaitTime(getMainLoopFrameDuration());
+
+        if (m_tooltipPossible)
+        {
+            if (m_tooltipTime < ToolTip::getInitialDelay())
+                limitWaitTime(ToolTip::getInitialDelay() - m_tooltipTime);
+            else
+                limitWaitTime(Duration{});
+        }
+
+        return waitTime;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Duration BackendGui::getMainLoopFrameDuration() const
+    {
+        if (m_frameRateLimit == 0)
+            return Duration{};
+
+        return std::chrono::nanoseconds(std::chrono::seconds(1)) / m_frameRateLimit;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2f BackendGui::mapPixelToCoords(Vector2i pixel) const
     {
         return {((pixel.x - m_viewport.getLeft()) * (m_view.getWidth() / m_viewport.getWidth())) + m_view.getLeft(),
@@ -611,7 +918,10 @@ namespace tgui
         if (m_backendRenderTarget)
             m_backendRenderTarget->setView(m_view.getRect(), m_viewport.getRect(), {static_cast<float>(m_framebufferSize.x), static_cast<float>(m_framebufferSize.y)});
 
+        // Widgets with layouts that depend on each other are only updated once, after the new size has fully propagated
+        Layout::beginBatchUpdate();
         m_container->setSize(Vector2f{m_view.getWidth(), m_view.getHeight()});
+        Layout::endBatchUpdate();
 
         // Derived classes should update m_view in their updateContainerSize() function before calling this function
         const FloatRect& viewRect = m_view.getRect();
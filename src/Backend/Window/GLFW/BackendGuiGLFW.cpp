@@ -374,27 +374,42 @@ namespace tgui
 
         setDrawingUpdatesTime(false);
 
+        bool refreshRequired = true;
         std::chrono::steady_clock::time_point lastRenderTime;
         while (!glfwWindowShouldClose(m_window))
         {
             // Don't try to render too often, even when the screen is changing (e.g. during animation)
-            const auto timePointNow = std::chrono::steady_clock::now();
-            const auto timePointNextAllowed = lastRenderTime + std::chrono::milliseconds(15);
-            if (timePointNextAllowed <= timePointNow)
+            auto timePointNow = std::chrono::steady_clock::now();
+            const auto timePointNextAllowed = lastRenderTime + std::chrono::nanoseconds(getMainLoopFrameDuration());
+            if (refreshRequired && (timePointNextAllowed <= timePointNow))
             {
                 m_backendRenderTarget->clearScreen();
                 draw();
                 glfwSwapBuffers(m_window);
                 lastRenderTime = std::chrono::steady_clock::now(); // Don't use timePointNow to provide enough rest on low-end hardware
+                timePointNow = lastRenderTime;
+
+                // The events are handled in callbacks, so we don't know when the screen has to be redrawn. Unless the main loop
+                // is event-driven (in which case we only wake up when something happens), we just redraw at the frame rate limit.
+                refreshRequired = !m_eventDrivenMainLoop;
+            }
+
+            // Wake up when something has to be updated or when we can render the next frame
+            Optional<Duration> waitTime = getMainLoopWaitTime();
+            if (refreshRequired && (timePointNextAllowed > timePointNow))
+            {
+                const Duration timeUntilNextFrame = std::chrono::duration_cast<std::chrono::nanoseconds>(timePointNextAllowed - timePointNow);
+                if (!waitTime || (timeUntilNextFrame < *waitTime))
+                    waitTime = timeUntilNextFrame;
             }
 
-            double eventTimeoutSeconds = 0.01;
-            Optional<Duration> duration = Timer::getNextScheduledTime();
-            if (duration && (*duration < std::chrono::milliseconds(10)))
-                eventTimeoutSeconds = static_cast<double>(duration->asSeconds());
+            if (waitTime)
+                glfwWaitEventsTimeout(static_cast<double>(waitTime->asSeconds()));
+            else
+                glfwWaitEvents();
 
-            glfwWaitEventsTimeout(eventTimeoutSeconds);
-            updateTime();
+            if (updateTime() || m_eventDrivenMainLoop)
+                refreshRequired = true;
         }
     }
 
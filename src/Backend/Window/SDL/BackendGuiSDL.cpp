@@ -419,46 +419,43 @@ namespace tgui
 
         m_backendRenderTarget->setClearColor(clearColor);
 
-        // Helper function that calculates the amount of time to sleep, which is 10ms unless a timer will expire before this time
-        const auto getTimerWakeUpTime = []{
-            Optional<Duration> duration = Timer::getNextScheduledTime();
-            if (duration && (*duration < std::chrono::milliseconds(10)))
-                return *duration;
-            else
-                return Duration{std::chrono::milliseconds(10)};
-        };
-
         setDrawingUpdatesTime(false);
 
         bool quit = false;
         bool refreshRequired = true;
         std::chrono::steady_clock::time_point lastRenderTime;
+
+        // Helper function that handles a single event and returns whether the screen may have to be redrawn
+        const auto processEvent = [this,&quit](const SDL_Event& event){
+            bool eventProcessed = handleEvent(event);
+
+            if (event.type == SDL_EVENT_QUIT)
+            {
+                quit = true;
+                eventProcessed = true;
+            }
+#if SDL_MAJOR_VERSION >= 3
+            else if (event.type == SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED)
+#else
+            else if ((event.type == SDL_WINDOWEVENT) && (event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED))
+#endif
+            {
+                eventProcessed = true;
+            }
+
+            return eventProcessed;
+        };
+
         while (!quit)
         {
             bool eventProcessed = false;
             while (true)
             {
-                // We could use SDL_WaitEventTimeout instead of SDL_PollEvent and custom timing in the future, but we would
-                // have to be careful not to keep calling the function with the same timeout while events keep coming.
                 SDL_Event event;
                 while (SDL_PollEvent(&event) != 0)
                 {
-                    if (handleEvent(event))
-                        eventProcessed = true;
-
-                    if (event.type == SDL_EVENT_QUIT)
-                    {
-                        quit = true;
-                        eventProcessed = true;
-                    }
-#if SDL_MAJOR_VERSION >= 3
-                    else if (event.type == SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED)
-#else
-                    else if ((event.type == SDL_WINDOWEVENT) && (event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED))
-#endif
-                    {
+                    if (processEvent(event))
                         eventProcessed = true;
-                    }
                 }
 
                 if (updateTime())
@@ -467,21 +464,37 @@ namespace tgui
                 if (eventProcessed || refreshRequired)
                     break;
 
-                std::this_thread::sleep_for(std::chrono::nanoseconds(getTimerWakeUpTime()));
+                // When the main loop is event-driven, we block until an event arrives or until something has to be updated.
+                // Otherwise we sleep for a short time before checking for new events again.
+                const Optional<Duration> waitTime = getMainLoopWaitTime();
+                if (!m_eventDrivenMainLoop)
+                    std::this_thread::sleep_for(std::chrono::nanoseconds(*waitTime));
+                else if (!waitTime)
+                {
+                    if (SDL_WaitEvent(&event) != 0)
+                        eventProcessed = processEvent(event);
+                }
+                else
+                {
+                    // The timeout is rounded up to not wake up just before the timer expires
+                    const int timeoutMs = static_cast<int>(std::ceil(waitTime->asSeconds() * 1000));
+                    if (SDL_WaitEventTimeout(&event, timeoutMs) != 0)
+                        eventProcessed = processEvent(event);
+                }
             }
 
             refreshRequired = true;
 
             // Don't try to render too often, even when the screen is changing (e.g. during animation)
             const auto timePointNow = std::chrono::steady_clock::now();
-            const auto timePointNextAllowed = lastRenderTime + std::chrono::milliseconds(15);
+            const auto timePointNextAllowed = lastRenderTime + std::chrono::nanoseconds(getMainLoopFrameDuration());
             if (timePointNextAllowed > timePointNow)
             {
-                const auto timerWakeUpTime = getTimerWakeUpTime();
-                if (timePointNextAllowed - timePointNow < timerWakeUpTime)
+                const Optional<Duration> waitTime = getMainLoopWaitTime();
+                if (!waitTime || (timePointNextAllowed - timePointNow < std::chrono::nanoseconds(*waitTime)))
                     std::this_thread::sleep_for(timePointNextAllowed - timePointNow);
                 else
-                    std::this_thread::sleep_for(std::chrono::nanoseconds(timerWakeUpTime));
+                    std::this_thread::sleep_for(std::chrono::nanoseconds(*waitTime));
 
                 continue;
             }
@@ -33,6 +33,7 @@
 #endif
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
     #include <thread>
 #endif
 
@@ -206,21 +207,36 @@ namespace tgui
 
         m_backendRenderTarget->setClearColor(clearColor);
 
-        // Helper function that calculates the amount of time to sleep, which is 10ms unless a timer will expire before this time
-        const auto getTimerWakeUpTime = []{
-            Optional<Duration> duration = Timer::getNextScheduledTime();
-            if (duration && (*duration < std::chrono::milliseconds(10)))
-                return *duration;
-            else
-                return Duration{std::chrono::milliseconds(10)};
-        };
-
         setDrawingUpdatesTime(false);
 
         sf::Event event;
         bool refreshRequired = true;
         std::chrono::steady_clock::time_point lastRenderTime;
         bool windowOpen = m_window->isOpen();
+
+        // Helper function that handles a single event and returns whether the screen may have to be redrawn
+        const auto processEvent = [this,&windowOpen](const sf::Event& eventSFML){
+            bool eventProcessed = handleEvent(eventSFML);
+
+            if (eventSFML.type == sf::Event::Closed)
+            {
+                // We don't call m_window->close() as it would destroy the OpenGL context, which will cause messages to be
+                // printed in the terminal later when we try to destroy our backend renderer (which tries to clean up OpenGL resources).
+                // The close function will be called by the window destructor.
+                windowOpen = false;
+                eventProcessed = true;
+            }
+            else if (eventSFML.type == sf::Event::Resized)
+            {
+                eventProcessed = true;
+            }
+
+            return eventProcessed;
+        };
+
+        // Maximum time to sleep in the main loop before polling for events again
+        const std::chrono::nanoseconds maxSleepTime = std::chrono::milliseconds(10);
+
         while (m_window->isOpen()) // Don't just check windowOpen, user code can also call window.close()
         {
             bool eventProcessed = false;
@@ -228,21 +244,8 @@ namespace tgui
             {
                 while (m_window->pollEvent(event))
                 {
-                    if (handleEvent(event))
-                        eventProcessed = true;
-
-                    if (event.type == sf::Event::Closed)
-                    {
-                        // We don't call m_window->close() as it would destroy the OpenGL context, which will cause messages to be
-                        // printed in the terminal later when we try to destroy our backend renderer (which tries to clean up OpenGL resources).
-                        // The close function will be called by the window destructor.
-                        windowOpen = false;
+                    if (processEvent(event))
                         eventProcessed = true;
-                    }
-                    else if (event.type == sf::Event::Resized)
-                    {
-                        eventProcessed = true;
-                    }
                 }
 
                 if (updateTime())
@@ -251,7 +254,16 @@ namespace tgui
                 if (eventProcessed || refreshRequired)
                     break;
 
-                std::this_thread::sleep_for(std::chrono::nanoseconds(getTimerWakeUpTime()));
+                // SFML can't wait for an event with a timeout, so we only block until the next event when the main loop is
+                // event-driven and nothing has to be updated. Otherwise we sleep until the next update, but never longer than
+                // a few milliseconds so that events are still polled while we are waiting.
+                const Optional<Duration> waitTime = getMainLoopWaitTime();
+                if (waitTime)
+                    std::this_thread::sleep_for(std::min(std::chrono::nanoseconds(*waitTime), maxSleepTime));
+                else if (m_window->waitEvent(event))
+                    eventProcessed = processEvent(event);
+                else
+                    break;
             }
 
             if (!windowOpen)
@@ -261,15 +273,15 @@ namespace tgui
 
             // Don't try to render too often, even when the screen is changing (e.g. during animation)
             const auto timePointNow = std::chrono::steady_clock::now();
-            const auto timePointNextAllowed = lastRenderTime + std::chrono::milliseconds(15);
+            const auto timePointNextAllowed = lastRenderTime + std::chrono::nanoseconds(getMainLoopFrameDuration());
             if (timePointNextAllowed > timePointNow)
             {
-                const auto timerWakeUpTime = getTimerWakeUpTime();
-                if (timePointNextAllowed - timePointNow < timerWakeUpTime)
-                    std::this_thread::sleep_for(timePointNextAllowed - timePointNow);
-                else
-                    std::this_thread::sleep_for(std::chrono::nanoseconds(timerWakeUpTime));
+                auto sleepTime = std::chrono::duration_cast<std::chrono::nanoseconds>(timePointNextAllowed - timePointNow);
+                const Optional<Duration> waitTime = getMainLoopWaitTime();
+                if (waitTime && (std::chrono::nanoseconds(*waitTime) < sleepTime))
+                    sleepTime = std::chrono::nanoseconds(*waitTime);
 
+                std::this_thread::sleep_for(std::min(sleepTime, maxSleepTime));
                 continue;
             }
 
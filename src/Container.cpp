@@ -33,6 +33,8 @@
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <fstream>
+    #include <algorithm>
+    #include <cmath>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -43,6 +45,52 @@ namespace tgui
 
     namespace
     {
+        // Widgets that cover more cells than this are checked at every mouse position instead of being stored in the grid
+        constexpr int maxSpatialIndexCellsPerWidget = 64;
+
+        int getSpatialIndexCell(float coordinate, float cellSize)
+        {
+            // Clamp the value to avoid overflows for widgets that are placed extremely far away
+            return static_cast<int>(std::max(-1e9f, std::min(1e9f, std::floor(coordinate / cellSize))));
+        }
+
+        std::uint64_t getSpatialIndexCellKey(int x, int y)
+        {
+            return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+        }
+
+        // Returns the bounding box of the widget, in the coordinate system of its parent
+        FloatRect getWidgetBoundsInParent(const Widget& widget)
+        {
+            const Vector2f size = widget.getSize();
+            const Vector2f origin{widget.getOrigin().x * size.x, widget.getOrigin().y * size.y};
+            const bool scaledOrRotated = (widget.getScale().x != 1) || (widget.getScale().y != 1) || (widget.getRotation() != 0);
+            if (!scaledOrRotated)
+                return {widget.getPosition() - origin, size};
+
+            const Vector2f rotOrigin{widget.getRotationOrigin().x * size.x, widget.getRotationOrigin().y * size.y};
+            const Vector2f scaleOrigin{widget.getScaleOrigin().x * size.x, widget.getScaleOrigin().y * size.y};
+
+            Transform transform;
+            transform.translate(widget.getPosition() - origin);
+            transform.rotate(widget.getRotation(), rotOrigin);
+            transform.scale(widget.getScale(), scaleOrigin);
+
+            const Vector2f corners[] = {transform.transformPoint({0, 0}), transform.transformPoint({size.x, 0}),
+                                        transform.transformPoint({0, size.y}), transform.transformPoint(size)};
+            Vector2f minPos = corners[0];
+            Vector2f maxPos = corners[0];
+            for (const auto& corner : corners)
+            {
+                minPos.x = std::min(minPos.x, corner.x);
+                minPos.y = std::min(minPos.y, corner.y);
+                maxPos.x = std::max(maxPos.x, corner.x);
+                maxPos.y = std::max(maxPos.y, corner.y);
+            }
+
+            return {minPos, maxPos - minPos};
+        }
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         void getAllRenderers(std::vector<RendererData*>& orderedRenderers, std::map<RendererData*, std::vector<const Widget*>>& rendererToWidgetsMap, const Container* container)
@@ -170,7 +218,9 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Container::Container(const Container& other) :
-        Widget{other}
+        Widget{other},
+        m_spatialIndexEnabled {other.m_spatialIndexEnabled},
+        m_spatialIndexCellSize{other.m_spatialIndexCellSize}
     {
         // Widgets with layouts that refer to each other need to be added simultaneously.
         // They all need to be in m_widgets before setParent is called on the first widget,
@@ -191,7 +241,9 @@ namespace tgui
         m_widgetBelowMouse        {std::move(other.m_widgetBelowMouse)},
         m_widgetWithLeftMouseDown {std::move(other.m_widgetWithLeftMouseDown)},
         m_widgetWithRightMouseDown{std::move(other.m_widgetWithRightMouseDown)},
-        m_focusedWidget           {std::move(other.m_focusedWidget)}
+        m_focusedWidget           {std::move(other.m_focusedWidget)},
+        m_spatialIndexEnabled     {std::move(other.m_spatialIndexEnabled)},
+        m_spatialIndexCellSize    {std::move(other.m_spatialIndexCellSize)}
     {
         // Parent of all widgets should be set to nullptr first, in case widgets have layouts depending on each other.
         // Otherwise calling setParent on one widget could cause another widget's position to be recalculated which could
@@ -201,6 +253,9 @@ namespace tgui
 
         for (auto& widget : m_widgets)
             widget->setParent(this);
+
+        rebuildSpatialIndex();
+        other.invalidateNameIndex();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -212,6 +267,10 @@ namespace tgui
             if (widget->getParent() == this)
                 widget->setParent(nullptr);
         }
+
+        // The container of a SubwidgetContainer can be replaced while the SubwidgetContainer stays inside its parent
+        if (m_nameIndexParent)
+            m_nameIndexParent->invalidateNameIndex();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -231,6 +290,9 @@ namespace tgui
             // Remove all the old widgets
             Container::removeAllWidgets();
 
+            m_spatialIndexEnabled = right.m_spatialIndexEnabled;
+            m_spatialIndexCellSize = right.m_spatialIndexCellSize;
+
             // Widgets with layouts that refer to each other need to be added simultaneously.
             // They all need to be in m_widgets before setParent is called on the first widget,
             // which is why we can't just use call add(widget) for each widget.
@@ -257,6 +319,8 @@ namespace tgui
             m_widgetWithLeftMouseDown  = std::move(right.m_widgetWithLeftMouseDown);
             m_widgetWithRightMouseDown = std::move(right.m_widgetWithRightMouseDown);
             m_focusedWidget            = std::move(right.m_focusedWidget);
+            m_spatialIndexEnabled      = std::move(right.m_spatialIndexEnabled);
+            m_spatialIndexCellSize     = std::move(right.m_spatialIndexCellSize);
             Widget::operator=(std::move(right));
 
             // Parent of all widgets should be set to nullptr first, in case widgets have layouts depending on each other.
@@ -267,6 +331,10 @@ namespace tgui
 
             for (auto& widget : m_widgets)
                 widget->setParent(this);
+
+            rebuildSpatialIndex();
+            invalidateNameIndex();
+            right.invalidateNameIndex();
         }
 
         return *this;
@@ -309,6 +377,26 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Widget::Ptr Container::get(const String& widgetName) const
+    {
+        // Unnamed widgets aren't stored in the index
+        if (widgetName.empty())
+            return findWidgetByName(widgetName);
+
+        const auto& nameIndex = getNameIndex();
+        const auto it = nameIndex.find(widgetName.toUtf32());
+        if (it == nameIndex.end())
+            return nullptr;
+
+        if (it->second.size() == 1)
+            return it->second.front()->shared_from_this();
+
+        // When multiple widgets have the same name then the tree is searched to find the one that comes first
+        return findWidgetByName(widgetName);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget::Ptr Container::findWidgetByName(const String& widgetName) const
     {
         // First search for direct children
         for (const auto& child : m_widgets)
@@ -345,6 +433,139 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    const std::unordered_map<std::u32string, std::vector<Widget*>>& Container::getNameIndex() const
+    {
+        if (m_nameIndexValid)
+            return m_nameIndex;
+
+        std::vector<std::pair<std::u32string, Widget*>> namedWidgets;
+        for (const auto& child : m_widgets)
+            getNamedWidgets(child.get(), namedWidgets);
+
+        m_nameIndex.clear();
+        for (auto& pair : namedWidgets)
+            m_nameIndex[std::move(pair.first)].push_back(pair.second);
+
+        m_nameIndexValid = true;
+        return m_nameIndex;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::getNamedWidgets(Widget* child, std::vector<std::pair<std::u32string, Widget*>>& namedWidgets)
+    {
+        if (!child->getWidgetName().empty())
+            namedWidgets.emplace_back(child->getWidgetName().toUtf32(), child);
+
+        const Container* childContainer = nullptr;
+        if (child->isContainer())
+            childContainer = static_cast<const Container*>(child);
+        else if (const auto* subWidgetContainer = dynamic_cast<const SubwidgetContainer*>(child))
+            childContainer = subWidgetContainer->getContainer();
+
+        if (childContainer)
+        {
+            for (const auto& pair : childContainer->getNameIndex())
+            {
+                for (Widget* widget : pair.second)
+                    namedWidgets.emplace_back(pair.first, widget);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::updateNameIndex(Widget* child, bool added)
+    {
+        // When the index of this container isn't valid then the indices of its parents aren't valid either
+        if (!m_nameIndexValid)
+            return;
+
+        std::vector<std::pair<std::u32string, Widget*>> namedWidgets;
+        getNamedWidgets(child, namedWidgets);
+        if (namedWidgets.empty())
+            return;
+
+        Container* container = this;
+        while (container && container->m_nameIndexValid)
+        {
+            for (const auto& pair : namedWidgets)
+            {
+                if (added)
+                {
+                    container->m_nameIndex[pair.first].push_back(pair.second);
+                    continue;
+                }
+
+                const auto it = container->m_nameIndex.find(pair.first);
+                if (it == container->m_nameIndex.end())
+                    continue;
+
+                auto& widgets = it->second;
+                widgets.erase(std::remove(widgets.begin(), widgets.end(), pair.second), widgets.end());
+                if (widgets.empty())
+                    container->m_nameIndex.erase(it);
+            }
+
+            if (container->m_parent)
+                container = container->m_parent;
+            else
+                container = container->m_nameIndexParent;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::childWidgetNameChanged(Widget* child, const String& oldName)
+    {
+        const std::u32string oldKey = oldName.toUtf32();
+        const std::u32string newKey = child->getWidgetName().toUtf32();
+
+        Container* container = this;
+        while (container && container->m_nameIndexValid)
+        {
+            if (!oldKey.empty())
+            {
+                const auto it = container->m_nameIndex.find(oldKey);
+                if (it != container->m_nameIndex.end())
+                {
+                    auto& widgets = it->second;
+                    widgets.erase(std::remove(widgets.begin(), widgets.end(), child), widgets.end());
+                    if (widgets.empty())
+                        container->m_nameIndex.erase(it);
+                }
+            }
+
+            if (!newKey.empty())
+                container->m_nameIndex[newKey].push_back(child);
+
+            if (container->m_parent)
+                container = container->m_parent;
+            else
+                container = container->m_nameIndexParent;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::invalidateNameIndex()
+    {
+        // When the index of a container is invalid then the indices of its parents are already invalid too
+        Container* container = this;
+        while (container && container->m_nameIndexValid)
+        {
+            container->m_nameIndexValid = false;
+            container->m_nameIndex.clear();
+
+            if (container->m_parent)
+                container = container->m_parent;
+            else
+                container = container->m_nameIndexParent;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::remove(const Widget::Ptr& widget)
     {
         // Loop through every widget
@@ -372,6 +593,12 @@ namespace tgui
             // Remove the widget
             widget->setParent(nullptr);
             m_widgets.erase(m_widgets.begin() + static_cast<std::ptrdiff_t>(i));
+            updateNameIndex(widget.get(), false);
+            if (m_spatialIndexEnabled)
+            {
+                removeFromSpatialIndex(widget.get());
+                m_spatialIndexOrderNeedsUpdate = true;
+            }
             return true;
         }
 
@@ -386,9 +613,13 @@ namespace tgui
             m_parentGui->requestMouseCursor(m_mouseCursor);
 
         for (const auto& widget : m_widgets)
+        {
             widget->setParent(nullptr);
+            updateNameIndex(widget.get(), false);
+        }
 
         m_widgets.clear();
+        rebuildSpatialIndex();
 
         m_widgetBelowMouse = nullptr;
         m_widgetWithLeftMouseDown = nullptr;
@@ -603,6 +834,7 @@ namespace tgui
 
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + static_cast<std::ptrdiff_t>(i));
+            m_spatialIndexOrderNeedsUpdate = true;
             break;
         }
     }
@@ -623,6 +855,7 @@ namespace tgui
 
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + static_cast<std::ptrdiff_t>(i + 1));
+            m_spatialIndexOrderNeedsUpdate = true;
             break;
         }
     }
@@ -641,6 +874,7 @@ namespace tgui
                 return m_widgets.size() - 1;
 
             std::swap(m_widgets[i], m_widgets[i+1]);
+            m_spatialIndexOrderNeedsUpdate = true;
             return i + 1;
         }
 
@@ -662,6 +896,7 @@ namespace tgui
                 return 0;
 
             std::swap(m_widgets[i-2], m_widgets[i-1]);
+            m_spatialIndexOrderNeedsUpdate = true;
             return i-2;
         }
 
@@ -695,6 +930,7 @@ namespace tgui
         // Move the widget to the new index
         m_widgets.erase(m_widgets.begin() + static_cast<std::ptrdiff_t>(currentWidgetIndex));
         m_widgets.insert(m_widgets.begin() + static_cast<std::ptrdiff_t>(index), widget);
+        m_spatialIndexOrderNeedsUpdate = true;
         return true;
     }
 
@@ -740,31 +976,22 @@ namespace tgui
     {
         pos -= getPosition() + getChildWidgetsOffset();
 
-        for (auto it = m_widgets.crbegin(); it != m_widgets.crend(); ++it)
-        {
-            const auto& widget = *it;
-
-            // Look for a visible widget below the mouse
-            if (!widget->isVisible())
-                continue;
-            if (!widget->isMouseOnWidget(transformMousePos(widget, pos)))
-                continue;
-
-            // If the widget is a container then look inside it
-            if (widget->isContainer())
-            {
-                Container::Ptr container = std::static_pointer_cast<Container>(widget);
-                auto childWidget = container->getWidgetAtPosition(transformMousePos(widget, pos));
-                if (childWidget)
-                    return childWidget;
-            }
+        // Look for a visible widget below the mouse
+        const auto widget = getWidgetBelowMouse(pos);
+        if (!widget)
+            return nullptr;
 
-            // If the widget isn't a container, or there were no child widgets inside it, then return this widget
-            return widget;
+        // If the widget is a container then look inside it
+        if (widget->isContainer())
+        {
+            Container::Ptr container = std::static_pointer_cast<Container>(widget);
+            auto childWidget = container->getWidgetAtPosition(transformMousePos(widget, pos));
+            if (childWidget)
+                return childWidget;
         }
 
-        // No visible widgets were found at the queried position
-        return nullptr;
+        // If the widget isn't a container, or there were no child widgets inside it, then return this widget
+        return widget;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1011,22 +1238,30 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::rendererChanged(const String& property)
+    void Container::rendererPropertyChanged(RendererPropertyId property)
     {
-        Widget::rendererChanged(property);
+        Widget::rendererPropertyChanged(property);
 
-        if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            for (const auto& widget : m_widgets)
-                widget->setInheritedOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
+        switch (property)
         {
-            for (const auto& widget : m_widgets)
+            case RendererPropertyId::Opacity:
+            case RendererPropertyId::OpacityDisabled:
             {
-                if (m_fontCached != Font::getGlobalFont())
-                    widget->setInheritedFont(m_fontCached);
+                for (const auto& widget : m_widgets)
+                    widget->setInheritedOpacity(m_opacityCached);
+                break;
+            }
+            case RendererPropertyId::Font:
+            {
+                for (const auto& widget : m_widgets)
+                {
+                    if (m_fontCached != Font::getGlobalFont())
+                        widget->setInheritedFont(m_fontCached);
+                }
+                break;
             }
+            default:
+                break;
         }
     }
 
@@ -1236,6 +1471,10 @@ namespace tgui
     {
         bool screenRefreshRequired = Widget::updateTime(elapsedTime);
 
+        // When the gui only updates active widgets, the child widgets are updated directly by the gui
+        if (m_parentGui && m_parentGui->getUpdateOnlyActiveWidgets())
+            return screenRefreshRequired;
+
         // Loop through all widgets
         for (auto& widget : m_widgets)
         {
@@ -1278,6 +1517,54 @@ namespace tgui
 
     Widget::Ptr Container::getWidgetBelowMouse(Vector2f mousePos) const
     {
+        if (m_spatialIndexEnabled)
+        {
+            if (m_spatialIndexOrderNeedsUpdate)
+            {
+                for (std::size_t i = 0; i < m_widgets.size(); ++i)
+                    m_spatialIndexEntries.at(m_widgets[i].get()).widgetIndex = i;
+
+                m_spatialIndexOrderNeedsUpdate = false;
+            }
+
+            // Only the widgets in the cell below the mouse and the widgets that aren't stored in the grid can be below the mouse.
+            // Out of those candidates, the one that was added last (i.e. the one in front) is checked first.
+            std::size_t candidateCount = m_spatialIndexUngriddedWidgets.size();
+            const auto cellIt = m_spatialIndexCells.find(getSpatialIndexCellKey(
+                getSpatialIndexCell(mousePos.x, m_spatialIndexCellSize), getSpatialIndexCell(mousePos.y, m_spatialIndexCellSize)));
+            if (cellIt != m_spatialIndexCells.end())
+                candidateCount += cellIt->second.size();
+
+            if (candidateCount == 0)
+                return nullptr;
+
+            auto& candidates = m_spatialIndexCandidates;
+            candidates.clear();
+            candidates.reserve(candidateCount);
+            for (const Widget* widget : m_spatialIndexUngriddedWidgets)
+                candidates.push_back(m_spatialIndexEntries.at(widget).widgetIndex);
+            if (cellIt != m_spatialIndexCells.end())
+            {
+                for (const Widget* widget : cellIt->second)
+                    candidates.push_back(m_spatialIndexEntries.at(widget).widgetIndex);
+            }
+
+            std::sort(candidates.begin(), candidates.end(), [](std::size_t a, std::size_t b){ return a > b; });
+            for (const std::size_t index : candidates)
+            {
+                const auto& widget = m_widgets[index];
+                if (!widget->isVisible())
+                    continue;
+
+                if (!widget->isMouseOnWidget(transformMousePos(widget, mousePos)))
+                    continue;
+
+                return widget;
+            }
+
+            return nullptr;
+        }
+
         for (auto it = m_widgets.crbegin(); it != m_widgets.crend(); ++it)
         {
             const auto& widget = *it;
@@ -1433,6 +1720,152 @@ namespace tgui
 
         if (m_textSizeCached != 0)
             widgetPtr->setTextSize(m_textSizeCached);
+
+        updateNameIndex(widgetPtr.get(), true);
+
+        if (m_spatialIndexEnabled)
+        {
+            addToSpatialIndex(widgetPtr.get());
+            m_spatialIndexOrderNeedsUpdate = true;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::setSpatialIndexEnabled(bool enabled)
+    {
+        if (m_spatialIndexEnabled == enabled)
+            return;
+
+        m_spatialIndexEnabled = enabled;
+        rebuildSpatialIndex();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isSpatialIndexEnabled() const
+    {
+        return m_spatialIndexEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::setSpatialIndexCellSize(float cellSize)
+    {
+        TGUI_ASSERT(cellSize > 0, "Cell size of spatial index must be positive");
+
+        m_spatialIndexCellSize = cellSize;
+        rebuildSpatialIndex();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float Container::getSpatialIndexCellSize() const
+    {
+        return m_spatialIndexCellSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::childWidgetBoundsChanged(const Widget* child)
+    {
+        if (!m_spatialIndexEnabled)
+            return;
+
+        // The widget may not be part of the index yet if its position changes while it is being added to the container
+        const auto entryIt = m_spatialIndexEntries.find(child);
+        if (entryIt == m_spatialIndexEntries.end())
+            return;
+
+        // The order of the widgets doesn't change, so the widget keeps its index
+        const std::size_t widgetIndex = entryIt->second.widgetIndex;
+        removeFromSpatialIndex(child);
+        addToSpatialIndex(child);
+        m_spatialIndexEntries[child].widgetIndex = widgetIndex;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::addToSpatialIndex(const Widget* widget)
+    {
+        SpatialIndexEntry& entry = m_spatialIndexEntries[widget];
+
+        if (widget->m_hitAreaLimitedToSize)
+        {
+            const FloatRect bounds = getWidgetBoundsInParent(*widget);
+            entry.left = getSpatialIndexCell(bounds.left, m_spatialIndexCellSize);
+            entry.top = getSpatialIndexCell(bounds.top, m_spatialIndexCellSize);
+            entry.right = getSpatialIndexCell(bounds.left + bounds.width, m_spatialIndexCellSize);
+            entry.bottom = getSpatialIndexCell(bounds.top + bounds.height, m_spatialIndexCellSize);
+
+            const auto cellCount = static_cast<std::int64_t>(entry.right - entry.left + 1) * static_cast<std::int64_t>(entry.bottom - entry.top + 1);
+            entry.inGrid = (cellCount <= maxSpatialIndexCellsPerWidget);
+        }
+        else
+            entry.inGrid = false;
+
+        if (!entry.inGrid)
+        {
+            m_spatialIndexUngriddedWidgets.push_back(widget);
+            return;
+        }
+
+        for (int y = entry.top; y <= entry.bottom; ++y)
+        {
+            for (int x = entry.left; x <= entry.right; ++x)
+                m_spatialIndexCells[getSpatialIndexCellKey(x, y)].push_back(widget);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::removeFromSpatialIndex(const Widget* widget)
+    {
+        const auto entryIt = m_spatialIndexEntries.find(widget);
+        if (entryIt == m_spatialIndexEntries.end())
+            return;
+
+        const SpatialIndexEntry& entry = entryIt->second;
+        if (entry.inGrid)
+        {
+            for (int y = entry.top; y <= entry.bottom; ++y)
+            {
+                for (int x = entry.left; x <= entry.right; ++x)
+                {
+                    const auto cellIt = m_spatialIndexCells.find(getSpatialIndexCellKey(x, y));
+                    if (cellIt == m_spatialIndexCells.end())
+                        continue;
+
+                    auto& cell = cellIt->second;
+                    cell.erase(std::remove(cell.begin(), cell.end(), widget), cell.end());
+                    if (cell.empty())
+                        m_spatialIndexCells.erase(cellIt);
+                }
+            }
+        }
+        else
+        {
+            m_spatialIndexUngriddedWidgets.erase(std::remove(m_spatialIndexUngriddedWidgets.begin(), m_spatialIndexUngriddedWidgets.end(), widget),
+                                                 m_spatialIndexUngriddedWidgets.end());
+        }
+
+        m_spatialIndexEntries.erase(entryIt);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::rebuildSpatialIndex()
+    {
+        m_spatialIndexEntries.clear();
+        m_spatialIndexCells.clear();
+        m_spatialIndexUngriddedWidgets.clear();
+        m_spatialIndexOrderNeedsUpdate = true;
+
+        if (!m_spatialIndexEnabled)
+            return;
+
+        for (const auto& widget : m_widgets)
+            addToSpatialIndex(widget.get());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
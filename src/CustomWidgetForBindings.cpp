@@ -38,6 +38,7 @@ namespace tgui
     CustomWidgetForBindings::CustomWidgetForBindings(const char* typeName, bool initRenderer) :
         Widget{typeName, initRenderer}
     {
+        m_hitAreaLimitedToSize = false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -126,6 +127,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool CustomWidgetForBindings::isUpdateTimeRequired() const
+    {
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool CustomWidgetForBindings::isMouseOnWidget(Vector2f pos) const
     {
         return implMouseOnWidget(pos);
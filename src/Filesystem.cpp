@@ -543,6 +543,54 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Filesystem::getFileInfo(const Path& path, FileInfo& fileInfo)
+    {
+#ifdef TGUI_USE_STD_FILESYSTEM_FILE_TIME
+        std::error_code errorCode;
+        const auto status = std::filesystem::status(path, errorCode);
+        if (errorCode || !std::filesystem::exists(status))
+            return false;
+
+        const auto lastWriteTime = std::filesystem::last_write_time(path, errorCode);
+        if (errorCode)
+            return false;
+
+        fileInfo.filename = path.getFilename();
+        fileInfo.path = path;
+        fileInfo.directory = std::filesystem::is_directory(status);
+        fileInfo.modificationTime = std::chrono::system_clock::to_time_t(std::chrono::clock_cast<std::chrono::system_clock>(lastWriteTime));
+        fileInfo.fileSize = fileInfo.directory ? 0 : std::filesystem::file_size(path, errorCode);
+        return !errorCode;
+#elif defined(TGUI_SYSTEM_WINDOWS)
+        WIN32_FILE_ATTRIBUTE_DATA attributes;
+        if (!GetFileAttributesExW(path.asNativeString().c_str(), GetFileExInfoStandard, &attributes))
+            return false;
+
+        fileInfo.filename = path.getFilename();
+        fileInfo.path = path;
+        fileInfo.directory = (attributes.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+        fileInfo.modificationTime = FileTimeToUnixTime(attributes.ftLastWriteTime);
+        if (!fileInfo.directory)
+            fileInfo.fileSize = (attributes.nFileSizeHigh * (static_cast<decltype(fileInfo.fileSize)>(MAXDWORD) + 1)) + attributes.nFileSizeLow;
+        else
+            fileInfo.fileSize = 0;
+        return true;
+#else
+        struct stat statFileInfo;
+        if ((stat(path.asNativeString().c_str(), &statFileInfo) != 0) || (statFileInfo.st_size < 0))
+            return false;
+
+        fileInfo.filename = path.getFilename();
+        fileInfo.path = path;
+        fileInfo.directory = (statFileInfo.st_mode & S_IFDIR);
+        fileInfo.modificationTime = statFileInfo.st_mtime;
+        fileInfo.fileSize = fileInfo.directory ? 0 : static_cast<decltype(fileInfo.fileSize)>(statFileInfo.st_size);
+        return true;
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
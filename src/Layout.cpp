@@ -27,10 +27,58 @@
 #include <TGUI/Widget.hpp>
 #include <TGUI/Backend/Window/BackendGui.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <unordered_set>
+    #include <algorithm>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    // Connected widget callbacks that are delayed until Layout::endBatchUpdate is called
+    struct DelayedLayoutCallbacks
+    {
+        unsigned int batchUpdateDepth = 0;
+        std::vector<Layout*> layoutsInOrder; // May still contain layouts that were removed from the set below
+        std::unordered_set<const Layout*> layouts;
+    };
+
+    TGUI_NODISCARD static DelayedLayoutCallbacks& getDelayedLayoutCallbacks()
+    {
+        static DelayedLayoutCallbacks delayedCallbacks;
+        return delayedCallbacks;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TGUI_NODISCARD static float calculateOperation(Layout::Operation operation, float leftValue, float rightValue)
+    {
+        switch (operation)
+        {
+            case Layout::Operation::Plus:
+                return leftValue + rightValue;
+            case Layout::Operation::Minus:
+                return leftValue - rightValue;
+            case Layout::Operation::Multiplies:
+                return leftValue * rightValue;
+            case Layout::Operation::Divides:
+                if (rightValue != 0)
+                    return leftValue / rightValue;
+                else
+                    return 0;
+            case Layout::Operation::Minimum:
+                return std::min(leftValue, rightValue);
+            case Layout::Operation::Maximum:
+                return std::max(leftValue, rightValue);
+            default:
+                TGUI_ASSERT(false, "calculateOperation can only be called with a math operation");
+                return 0;
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     TGUI_NODISCARD static std::pair<String, String> parseMinMaxExpresssion(const String& expression)
     {
         unsigned int bracketCount = 0;
@@ -246,8 +294,8 @@ namespace tgui
             std::advance(nextOperandIt, 1);
 
             (*operandIt) = Layout{operatorToApply,
-                                  std::make_unique<Layout>(*operandIt),
-                                  std::make_unique<Layout>(*nextOperandIt)};
+                                  std::make_unique<Layout>(std::move(*operandIt)),
+                                  std::make_unique<Layout>(std::move(*nextOperandIt))};
 
             operands.erase(nextOperandIt);
         }
@@ -272,20 +320,20 @@ namespace tgui
                 if (operatorToApply == Operation::Minus)
                     nextOperandIt->m_value = -nextOperandIt->m_value;
 
-                *operandIt = *nextOperandIt;
+                *operandIt = std::move(*nextOperandIt);
             }
             else // Normal addition or subtraction
             {
                 *operandIt = Layout{operatorToApply,
-                                    std::make_unique<Layout>(*operandIt),
-                                    std::make_unique<Layout>(*nextOperandIt)};
+                                    std::make_unique<Layout>(std::move(*operandIt)),
+                                    std::make_unique<Layout>(std::move(*nextOperandIt))};
             }
 
             operands.erase(nextOperandIt);
         }
 
         TGUI_ASSERT(operands.size() == 1, "Layout constructor should reduce expression to single result");
-        *this = operands.front();
+        *this = std::move(operands.front());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -343,7 +391,9 @@ namespace tgui
         TGUI_ASSERT(m_rightOperand != nullptr, "Right operand in layout constructor can't be a nullptr");
 
         resetPointers();
-        recalculateValue();
+
+        // The program isn't compiled yet, this layout may still become the operand of another layout
+        m_value = calculateOperation(m_operation, m_leftOperand->getValue(), m_rightOperand->getValue());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -356,7 +406,8 @@ namespace tgui
         m_rightOperand   {other.m_rightOperand ? std::make_unique<Layout>(*other.m_rightOperand) : nullptr},
         m_boundWidget    {other.m_boundWidget},
         m_boundString    {other.m_boundString},
-        m_connectedWidgetCallback{nullptr}
+        m_connectedWidgetCallback{nullptr},
+        m_connectedWidget{nullptr}
     {
         // Disconnect the bound widget if a string was used, the same name may apply to a different widget now
         if (!m_boundString.empty())
@@ -375,9 +426,19 @@ namespace tgui
         m_rightOperand   {std::move(other.m_rightOperand)},
         m_boundWidget    {other.m_boundWidget},
         m_boundString    {std::move(other.m_boundString)},
-        m_connectedWidgetCallback{std::move(other.m_connectedWidgetCallback)}
+        m_connectedWidgetCallback{std::move(other.m_connectedWidgetCallback)},
+        m_connectedWidget{other.m_connectedWidget},
+        m_program        {std::move(other.m_program)},
+        m_programStackSize{other.m_programStackSize}
     {
         resetPointers();
+
+        auto& delayedCallbacks = getDelayedLayoutCallbacks();
+        if (!delayedCallbacks.layouts.empty() && (delayedCallbacks.layouts.erase(&other) > 0))
+        {
+            delayedCallbacks.layouts.insert(this);
+            delayedCallbacks.layoutsInOrder.push_back(this);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -387,6 +448,7 @@ namespace tgui
         if (this != &other)
         {
             unbindLayout();
+            cancelDelayedCallback();
 
             m_value           = other.m_value;
             m_parent          = nullptr;
@@ -396,6 +458,8 @@ namespace tgui
             m_boundWidget     = other.m_boundWidget;
             m_boundString     = other.m_boundString;
             m_connectedWidgetCallback = nullptr;
+            m_connectedWidget = nullptr;
+            m_program.clear();
 
             // Disconnect the bound widget if a string was used, the same name may apply to a different widget now
             if (!m_boundString.empty())
@@ -423,8 +487,19 @@ namespace tgui
             m_boundWidget     = other.m_boundWidget;
             m_boundString     = std::move(other.m_boundString);
             m_connectedWidgetCallback = std::move(other.m_connectedWidgetCallback);
+            m_connectedWidget = other.m_connectedWidget;
+            m_program         = std::move(other.m_program);
+            m_programStackSize = other.m_programStackSize;
 
             resetPointers();
+
+            cancelDelayedCallback();
+            auto& delayedCallbacks = getDelayedLayoutCallbacks();
+            if (!delayedCallbacks.layouts.empty() && (delayedCallbacks.layouts.erase(&other) > 0))
+            {
+                delayedCallbacks.layouts.insert(this);
+                delayedCallbacks.layoutsInOrder.push_back(this);
+            }
         }
 
         return *this;
@@ -435,6 +510,7 @@ namespace tgui
     Layout::~Layout()
     {
         unbindLayout();
+        cancelDelayedCallback();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -448,7 +524,10 @@ namespace tgui
 
         // Inform the parent that the value of the layout has changed
         if (m_parent)
+        {
+            m_parent->invalidateProgram();
             m_parent->recalculateValue();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -587,6 +666,10 @@ namespace tgui
 
             m_leftOperand->m_parent = this;
             m_rightOperand->m_parent = this;
+
+            // Only the topmost layout has a program
+            m_leftOperand->m_program.clear();
+            m_rightOperand->m_program.clear();
         }
 
         if (m_boundWidget)
@@ -618,6 +701,7 @@ namespace tgui
 
         // Restore the callback function
         m_connectedWidgetCallback = std::move(valueChangedCallbackHandler);
+        m_connectedWidget = widget;
 
         if (m_value != oldValue)
         {
@@ -654,25 +738,17 @@ namespace tgui
             case Operation::Value:
                 break;
             case Operation::Plus:
-                m_value = m_leftOperand->getValue() + m_rightOperand->getValue();
-                break;
             case Operation::Minus:
-                m_value = m_leftOperand->getValue() - m_rightOperand->getValue();
-                break;
             case Operation::Multiplies:
-                m_value = m_leftOperand->getValue() * m_rightOperand->getValue();
-                break;
             case Operation::Divides:
-                if (m_rightOperand->getValue() != 0)
-                    m_value = m_leftOperand->getValue() / m_rightOperand->getValue();
-                else
-                    m_value = 0;
-                break;
             case Operation::Minimum:
-                m_value = std::min(m_leftOperand->getValue(), m_rightOperand->getValue());
-                break;
             case Operation::Maximum:
-                m_value = std::max(m_leftOperand->getValue(), m_rightOperand->getValue());
+                // The topmost layout calculates its value with its program. An operand only calculates its own operation,
+                // which happens when one of its operands was replaced.
+                if (m_parent)
+                    m_value = calculateOperation(m_operation, m_leftOperand->getValue(), m_rightOperand->getValue());
+                else
+                    m_value = evaluateProgram();
                 break;
             case Operation::BindingPosX:
                 m_value = m_boundWidget->getPosition().x;
@@ -714,14 +790,289 @@ namespace tgui
 
         if (m_value != oldValue)
         {
+            // Instead of recalculating each parent in turn, the topmost layout executes its program which updates all of them
             if (m_parent)
-                m_parent->recalculateValue();
+            {
+                Layout* topmostLayout = m_parent;
+                while (topmostLayout->m_parent)
+                    topmostLayout = topmostLayout->m_parent;
+
+                topmostLayout->recalculateValue();
+            }
             else
             {
                 // The topmost layout must tell the connected widget about the new value
                 if (m_connectedWidgetCallback)
-                    m_connectedWidgetCallback();
+                    notifyConnectedWidget();
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::compileProgram()
+    {
+        m_program.clear();
+        compileOperand(*this);
+
+        std::size_t stackSize = 0;
+        m_programStackSize = 0;
+        for (const auto& instruction : m_program)
+        {
+            if (instruction.operation == Operation::Value)
+                m_programStackSize = std::max(m_programStackSize, ++stackSize);
+            else
+                --stackSize;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::compileOperand(Layout& layout)
+    {
+        // Constants are stored in the program, the values of bindings are read from their layout when executing the program
+        if (!layout.m_leftOperand)
+        {
+            if (layout.m_operation == Operation::Value)
+                m_program.push_back({Operation::Value, layout.m_value, nullptr});
+            else
+                m_program.push_back({Operation::Value, 0, &layout});
+
+            return;
+        }
+
+        const std::size_t leftStart = m_program.size();
+        compileOperand(*layout.m_leftOperand);
+        const std::size_t rightStart = m_program.size();
+        compileOperand(*layout.m_rightOperand);
+
+        // If both operands are constants then the result is calculated now and the operation becomes a single constant
+        const auto isConstantInstruction = [](const Instruction& instruction){
+            return (instruction.operation == Operation::Value) && !instruction.layout;
+        };
+        if ((rightStart == leftStart + 1) && (m_program.size() == rightStart + 1)
+         && isConstantInstruction(m_program[leftStart]) && isConstantInstruction(m_program[rightStart]))
+        {
+            const float value = calculateOperation(layout.m_operation, m_program[leftStart].constant, m_program[rightStart].constant);
+            m_program.resize(leftStart);
+            m_program.push_back({Operation::Value, value, nullptr});
+            return;
+        }
+
+        // The result of an operand is stored in its layout, so that getValue() keeps working on the operands.
+        // The topmost layout doesn't store its result here, it can be moved while the program still exists.
+        m_program.push_back({layout.m_operation, 0, (&layout != this) ? &layout : nullptr});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float Layout::evaluateProgram()
+    {
+        if (m_program.empty())
+            compileProgram();
+
+        // Most expressions are short, so the stack normally doesn't require an allocation
+        constexpr std::size_t localStackSize = 16;
+        float localStack[localStackSize] = {};
+        std::vector<float> largeStack;
+        float* stack = localStack;
+        if (m_programStackSize > localStackSize)
+        {
+            largeStack.resize(m_programStackSize);
+            stack = largeStack.data();
+        }
+
+        std::size_t stackSize = 0;
+        for (const auto& instruction : m_program)
+        {
+            if (instruction.operation == Operation::Value)
+            {
+                stack[stackSize++] = instruction.layout ? instruction.layout->m_value : instruction.constant;
+                continue;
             }
+
+            --stackSize;
+            stack[stackSize - 1] = calculateOperation(instruction.operation, stack[stackSize - 1], stack[stackSize]);
+            if (instruction.layout)
+                instruction.layout->m_value = stack[stackSize - 1];
+        }
+
+        TGUI_ASSERT(stackSize == 1, "Layout program should leave exactly one value on the stack");
+        return stack[0];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::invalidateProgram()
+    {
+        Layout* topmostLayout = this;
+        while (topmostLayout->m_parent)
+            topmostLayout = topmostLayout->m_parent;
+
+        topmostLayout->m_program.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::beginBatchUpdate()
+    {
+        ++getDelayedLayoutCallbacks().batchUpdateDepth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::endBatchUpdate()
+    {
+        auto& delayedCallbacks = getDelayedLayoutCallbacks();
+        TGUI_ASSERT(delayedCallbacks.batchUpdateDepth > 0, "Layout::endBatchUpdate called without matching beginBatchUpdate");
+        if (delayedCallbacks.batchUpdateDepth > 1)
+        {
+            --delayedCallbacks.batchUpdateDepth;
+            return;
+        }
+
+        // Callbacks remain delayed while the widgets are being updated, so that a widget that is affected by several of the
+        // updates still only gets updated once. We keep going until no more layouts are changed.
+        struct BatchUpdateEndGuard
+        {
+            ~BatchUpdateEndGuard() { getDelayedLayoutCallbacks().batchUpdateDepth = 0; }
+        } guard;
+
+        std::vector<Layout*> layoutsInOrder;
+        std::vector<const Layout*> visitedLayouts;
+        while (!delayedCallbacks.layouts.empty())
+        {
+            layoutsInOrder.clear();
+            layoutsInOrder.swap(delayedCallbacks.layoutsInOrder);
+            for (Layout* layout : layoutsInOrder)
+            {
+                // The layout may no longer exist, so it can't be dereferenced unless it is still found in the set
+                if (delayedCallbacks.layouts.find(layout) == delayedCallbacks.layouts.end())
+                    continue;
+
+                visitedLayouts.clear();
+                layout->executeDelayedCallback(visitedLayouts);
+            }
+        }
+
+        delayedCallbacks.layoutsInOrder.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::notifyConnectedWidget()
+    {
+        auto& delayedCallbacks = getDelayedLayoutCallbacks();
+        if (delayedCallbacks.batchUpdateDepth == 0)
+        {
+            m_connectedWidgetCallback();
+            return;
+        }
+
+        if (delayedCallbacks.layouts.insert(this).second)
+            delayedCallbacks.layoutsInOrder.push_back(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::cancelDelayedCallback()
+    {
+        auto& delayedCallbacks = getDelayedLayoutCallbacks();
+        if (!delayedCallbacks.layouts.empty())
+            delayedCallbacks.layouts.erase(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::executeDelayedCallback(std::vector<const Layout*>& visitedLayouts)
+    {
+        // Don't get stuck when layouts depend on each other
+        if (std::find(visitedLayouts.begin(), visitedLayouts.end(), this) != visitedLayouts.end())
+            return;
+        visitedLayouts.push_back(this);
+
+        // The callback updates the position or size of the widget with the values of both axes. If the other axis is also
+        // waiting for an update then it is handled together with this layout, so that the widget is only updated once.
+        auto& delayedCallbacks = getDelayedLayoutCallbacks();
+        Layout* otherAxisLayout = getOtherAxisLayout();
+        if (otherAxisLayout
+         && ((delayedCallbacks.layouts.find(otherAxisLayout) == delayedCallbacks.layouts.end())
+          || (std::find(visitedLayouts.begin(), visitedLayouts.end(), otherAxisLayout) != visitedLayouts.end())))
+        {
+            otherAxisLayout = nullptr;
+        }
+
+        if (otherAxisLayout)
+            visitedLayouts.push_back(otherAxisLayout);
+
+        // If the widgets that we depend on are also waiting for an update then they have to be updated first, otherwise
+        // our value could still change after we updated our own widget.
+        std::vector<Widget*> boundWidgets;
+        getBoundWidgets(boundWidgets);
+        if (otherAxisLayout)
+            otherAxisLayout->getBoundWidgets(boundWidgets);
+
+        std::vector<const Layout*> dependencies;
+        for (const Widget* widget : boundWidgets)
+        {
+            const Layout2d& positionLayout = widget->getPositionLayout();
+            const Layout2d& sizeLayout = widget->getSizeLayout();
+            for (const Layout* layout : {&positionLayout.x, &positionLayout.y, &sizeLayout.x, &sizeLayout.y})
+            {
+                if ((layout != this) && (layout != otherAxisLayout) && (delayedCallbacks.layouts.find(layout) != delayedCallbacks.layouts.end()))
+                    dependencies.push_back(layout);
+            }
+        }
+
+        // Executing a callback may destroy other layouts, so we check that the dependency still exists before executing it
+        for (const Layout* dependency : dependencies)
+        {
+            if (delayedCallbacks.layouts.find(dependency) != delayedCallbacks.layouts.end())
+                const_cast<Layout*>(dependency)->executeDelayedCallback(visitedLayouts);
+        }
+
+        const bool delayed = (delayedCallbacks.layouts.erase(this) > 0);
+        const bool otherAxisDelayed = otherAxisLayout && (delayedCallbacks.layouts.erase(otherAxisLayout) > 0);
+        if (delayed && m_connectedWidgetCallback)
+            m_connectedWidgetCallback();
+        else if (otherAxisDelayed && otherAxisLayout->m_connectedWidgetCallback)
+            otherAxisLayout->m_connectedWidgetCallback();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Layout* Layout::getOtherAxisLayout() const
+    {
+        if (!m_connectedWidget)
+            return nullptr;
+
+        const Layout2d& positionLayout = m_connectedWidget->getPositionLayout();
+        const Layout2d& sizeLayout = m_connectedWidget->getSizeLayout();
+        const Layout* otherAxisLayout = nullptr;
+        if (this == &positionLayout.x)
+            otherAxisLayout = &positionLayout.y;
+        else if (this == &positionLayout.y)
+            otherAxisLayout = &positionLayout.x;
+        else if (this == &sizeLayout.x)
+            otherAxisLayout = &sizeLayout.y;
+        else if (this == &sizeLayout.y)
+            otherAxisLayout = &sizeLayout.x;
+
+        // The layouts are owned by the widget, they are only const because the widget returns them as const references
+        return const_cast<Layout*>(otherAxisLayout);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::getBoundWidgets(std::vector<Widget*>& widgets) const
+    {
+        if (m_boundWidget)
+            widgets.push_back(m_boundWidget);
+
+        if (m_leftOperand)
+        {
+            m_leftOperand->getBoundWidgets(widgets);
+            m_rightOperand->getBoundWidgets(widgets);
         }
     }
 
@@ -26,6 +26,59 @@
 #include <TGUI/Loading/ImageLoader.hpp>
 #include <TGUI/Global.hpp>
 
+#include <algorithm> // min
+#include <atomic>
+#include <chrono>
+#include <cstring> // memcpy, memcmp
+#include <limits>
+#include <new> // nothrow
+#include <string>
+
+#include <stdio.h> // C header for compatibility with _wfopen_s, NOLINT(modernize-deprecated-headers)
+
+#if defined(TGUI_SYSTEM_WINDOWS)
+    #include <TGUI/extlibs/IncludeWindows.hpp>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if !TGUI_USE_SYSTEM_STB
+namespace
+{
+    // stb_image allocates its memory with new[] so that the decoded pixels can be returned without having to copy them
+    void* stbiMalloc(std::size_t size)
+    {
+        return new (std::nothrow) std::uint8_t[size];
+    }
+
+    void stbiFree(void* ptr)
+    {
+        delete[] static_cast<std::uint8_t*>(ptr);
+    }
+
+    void* stbiReallocSized(void* ptr, std::size_t oldSize, std::size_t newSize)
+    {
+        std::uint8_t* newPtr = new (std::nothrow) std::uint8_t[newSize];
+        if (!newPtr)
+            return nullptr; // Just like realloc, the original memory remains valid when allocating fails
+
+        if (ptr)
+        {
+            std::memcpy(newPtr, ptr, std::min(oldSize, newSize));
+            delete[] static_cast<std::uint8_t*>(ptr);
+        }
+
+        return newPtr;
+    }
+}
+
+#define STBI_MALLOC(size) stbiMalloc(size)
+#define STBI_FREE(ptr) stbiFree(ptr)
+#define STBI_REALLOC_SIZED(ptr, oldSize, newSize) stbiReallocSized(ptr, oldSize, newSize)
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 #if defined(__GNUC__)
 #   pragma GCC diagnostic push
 #   pragma GCC diagnostic ignored "-Wold-style-cast"
@@ -81,49 +134,367 @@
 #   endif
 #endif
 
-#include <cstring> // memcpy
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Every file in the disk cache starts with these bytes, followed by the image size, the modification time and size
+    // of the original file, the path of the original file and finally the RGBA pixels.
+    constexpr char diskCacheMagic[8] = {'T', 'G', 'U', 'I', 'I', 'M', 'G', '1'};
+
+    using FilePtr = std::unique_ptr<FILE, decltype(&fclose)>;
+
+    TGUI_NODISCARD FilePtr openBinaryFile(const tgui::String& filename, bool write)
+    {
+        // On Windows, we use _wfopen_s with MSVC, MinGW-w64 and Clang (both LLVM Clang and Clang-CL).
+        // With MinGW.org based TDM-GCC, we can't use _wfopen_s so we call _wfopen if the function is defined (i.e. if __STRICT_ANSI__ is undefined).
+        // If _wfopen is unavailable, we simply use fopen (and hope that the system uses UTF-8 or that filename only contains ASCII characters).
+#if defined(TGUI_SYSTEM_WINDOWS) && (defined(_MSC_VER) || defined(__MINGW64_VERSION_MAJOR) || defined(__clang__))
+        FILE* file = nullptr;
+        if (_wfopen_s(&file, filename.toWideString().c_str(), write ? L"wb" : L"rb") != 0)
+            return {nullptr, &fclose};
+#elif defined(TGUI_SYSTEM_WINDOWS) && !defined(__STRICT_ANSI__)
+        FILE* file = _wfopen(filename.toWideString().c_str(), write ? L"wb" : L"rb");
+#else
+        FILE* file = fopen(filename.toStdString().c_str(), write ? "wb" : "rb");
+#endif
+        return {file, &fclose};
+    }
+
+    int readFileCallback(void* user, char* data, int size)
+    {
+        return static_cast<int>(fread(data, 1, static_cast<std::size_t>(size), static_cast<FILE*>(user)));
+    }
+
+    void skipFileCallback(void* user, int n)
+    {
+        (void)fseek(static_cast<FILE*>(user), n, SEEK_CUR);
+    }
+
+    int eofFileCallback(void* user)
+    {
+        return feof(static_cast<FILE*>(user)) || ferror(static_cast<FILE*>(user));
+    }
+
+    // Turns the buffer that was returned by stb_image into the pixels that are returned by the image loader
+    TGUI_NODISCARD std::unique_ptr<std::uint8_t[]> takeDecodedPixels(stbi_uc* buffer, int width, int height, tgui::Vector2u& imageSize)
+    {
+        if (!buffer)
+            return nullptr;
+
+        if ((width <= 0) || (height <= 0))
+        {
+            stbi_image_free(buffer);
+            return nullptr;
+        }
+
+        imageSize.x = static_cast<unsigned int>(width);
+        imageSize.y = static_cast<unsigned int>(height);
+
+#if TGUI_USE_SYSTEM_STB
+        // We don't know how the system library allocated the memory, so we have to copy the pixels
+        const std::size_t pixelDataSize = 4 * static_cast<std::size_t>(width) * static_cast<std::size_t>(height);
+        auto pixelData = tgui::MakeUniqueForOverwrite<std::uint8_t[]>(pixelDataSize);
+        std::memcpy(pixelData.get(), buffer, pixelDataSize);
+        stbi_image_free(buffer);
+        return pixelData;
+#else
+        return std::unique_ptr<std::uint8_t[]>(buffer);
+#endif
+    }
+
+    // The file is read while the image is being decoded, instead of first reading the entire file into memory
+    TGUI_NODISCARD std::unique_ptr<std::uint8_t[]> decodeFile(const tgui::String& filename, tgui::Vector2u& imageSize)
+    {
+#ifdef TGUI_SYSTEM_ANDROID
+        // Assets can't be opened like a regular file, they have to be read into memory first
+        if (!filename.empty() && (filename[0] != '/'))
+        {
+            std::size_t fileSize;
+            const auto fileContents = tgui::readFileToMemory(filename, fileSize);
+            if (!fileContents)
+                return nullptr;
+
+            return tgui::ImageLoader::loadFromMemory(fileContents.get(), fileSize, imageSize);
+        }
+#endif
+
+        const FilePtr file = openBinaryFile(filename, false);
+        if (!file)
+            return nullptr;
+
+        const stbi_io_callbacks callbacks = {&readFileCallback, &skipFileCallback, &eofFileCallback};
+
+        int imgWidth;
+        int imgHeight;
+        int imgChannels;
+        stbi_uc* buffer = stbi_load_from_callbacks(&callbacks, file.get(), &imgWidth, &imgHeight, &imgChannels, 4);
+        return takeDecodedPixels(buffer, imgWidth, imgHeight, imageSize);
+    }
+
+    // Replaces the destination file by the source file. The destination is never left partially written.
+    TGUI_NODISCARD bool replaceFile(const tgui::String& source, const tgui::String& destination)
+    {
+#if defined(TGUI_SYSTEM_WINDOWS)
+        return MoveFileExW(source.toWideString().c_str(), destination.toWideString().c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+        return ::rename(source.toStdString().c_str(), destination.toStdString().c_str()) == 0;
+#endif
+    }
+
+    void removeFile(const tgui::String& filename)
+    {
+#if defined(TGUI_SYSTEM_WINDOWS)
+        (void)DeleteFileW(filename.toWideString().c_str());
+#else
+        (void)::remove(filename.toStdString().c_str());
+#endif
+    }
+
+    // Returns the amount of bytes between the current position and the end of the file
+    TGUI_NODISCARD bool getRemainingFileSize(FILE* file, std::uint64_t& remainingSize)
+    {
+        const long position = ftell(file);
+        if ((position < 0) || (fseek(file, 0, SEEK_END) != 0))
+            return false;
+
+        const long endPosition = ftell(file);
+        if ((endPosition < position) || (fseek(file, position, SEEK_SET) != 0))
+            return false;
+
+        remainingSize = static_cast<std::uint64_t>(endPosition - position);
+        return true;
+    }
+
+    template <typename T>
+    TGUI_NODISCARD bool readValue(FILE* file, T& value)
+    {
+        return fread(&value, sizeof(T), 1, file) == 1;
+    }
+
+    template <typename T>
+    TGUI_NODISCARD bool writeValue(FILE* file, const T& value)
+    {
+        return fwrite(&value, sizeof(T), 1, file) == 1;
+    }
+
+    // The cache filename is a FNV-1a hash of the path of the original image
+    TGUI_NODISCARD tgui::String getDiskCacheFilename(const std::string& key)
+    {
+        std::uint64_t hash = 14695981039346656037u;
+        for (const char c : key)
+        {
+            hash ^= static_cast<std::uint8_t>(c);
+            hash *= 1099511628211u;
+        }
+
+        static constexpr char hexDigits[] = "0123456789abcdef";
+        std::string filename(16, '0');
+        for (std::size_t i = 0; i < 16; ++i)
+            filename[15 - i] = hexDigits[(hash >> (4 * i)) & 0xF];
+
+        return tgui::String(filename + ".rgba");
+    }
+
+    TGUI_NODISCARD std::unique_ptr<std::uint8_t[]> readFromDiskCache(const tgui::String& cacheFilename, const std::string& key,
+                                                                       const tgui::Filesystem::FileInfo& fileInfo, tgui::Vector2u& imageSize)
+    {
+        const FilePtr file = openBinaryFile(cacheFilename, false);
+        if (!file)
+            return nullptr;
+
+        char magic[sizeof(diskCacheMagic)];
+        if ((fread(magic, 1, sizeof(magic), file.get()) != sizeof(magic)) || (std::memcmp(magic, diskCacheMagic, sizeof(magic)) != 0))
+            return nullptr;
+
+        std::uint32_t width;
+        std::uint32_t height;
+        std::int64_t modificationTime;
+        std::uint64_t fileSize;
+        std::uint32_t keyLength;
+        if (!readValue(file.get(), width) || !readValue(file.get(), height) || !readValue(file.get(), modificationTime)
+         || !readValue(file.get(), fileSize) || !readValue(file.get(), keyLength))
+            return nullptr;
+
+        if ((width == 0) || (height == 0)
+         || (modificationTime != static_cast<std::int64_t>(fileInfo.modificationTime))
+         || (fileSize != static_cast<std::uint64_t>(fileInfo.fileSize))
+         || (keyLength != key.length()))
+            return nullptr;
+
+        std::string storedKey(keyLength, '\0');
+        if ((fread(&storedKey[0], 1, keyLength, file.get()) != keyLength) || (storedKey != key))
+            return nullptr;
+
+        // The image size has to match the amount of pixel data in the file. A corrupt header could otherwise overflow the
+        // size calculation or make us allocate a huge buffer before noticing that the file is too small.
+        if (static_cast<std::size_t>(height) > std::numeric_limits<std::size_t>::max() / 4 / width)
+            return nullptr;
+
+        const std::size_t pixelDataSize = 4 * static_cast<std::size_t>(width) * static_cast<std::size_t>(height);
+        std::uint64_t remainingFileSize;
+        if (!getRemainingFileSize(file.get(), remainingFileSize) || (remainingFileSize != pixelDataSize))
+            return nullptr;
+
+        // The pixels are read directly into the buffer that will be uploaded to the texture
+        auto pixelData = tgui::MakeUniqueForOverwrite<std::uint8_t[]>(pixelDataSize);
+        if (fread(pixelData.get(), 1, pixelDataSize, file.get()) != pixelDataSize)
+            return nullptr;
+
+        imageSize = {width, height};
+        return pixelData;
+    }
+
+    bool writeToDiskCache(const tgui::String& cacheFilename, const std::string& key, const tgui::Filesystem::FileInfo& fileInfo,
+                          const std::uint8_t* pixelData, tgui::Vector2u imageSize)
+    {
+        // The file is written under a temporary name and then renamed, so that readers never see a partially written file.
+        // The name has to be unique, as the same image may be decoded by multiple threads or processes at the same time.
+        static std::atomic<unsigned int> tempFileCounter{0};
+        const tgui::String tempFilename = cacheFilename
+            + U"." + tgui::String::fromNumber(std::chrono::steady_clock::now().time_since_epoch().count())
+            + U"-" + tgui::String::fromNumber(++tempFileCounter) + U".tmp";
+
+        FilePtr file = openBinaryFile(tempFilename, true);
+        if (!file)
+            return false;
+
+        const std::size_t pixelDataSize = 4 * static_cast<std::size_t>(imageSize.x) * static_cast<std::size_t>(imageSize.y);
+        const bool written = (fwrite(diskCacheMagic, 1, sizeof(diskCacheMagic), file.get()) == sizeof(diskCacheMagic))
+            && writeValue(file.get(), static_cast<std::uint32_t>(imageSize.x))
+            && writeValue(file.get(), static_cast<std::uint32_t>(imageSize.y))
+            && writeValue(file.get(), static_cast<std::int64_t>(fileInfo.modificationTime))
+            && writeValue(file.get(), static_cast<std::uint64_t>(fileInfo.fileSize))
+            && writeValue(file.get(), static_cast<std::uint32_t>(key.length()))
+            && (fwrite(key.data(), 1, key.length(), file.get()) == key.length())
+            && (fwrite(pixelData, 1, pixelDataSize, file.get()) == pixelDataSize);
+
+        // The file has to be closed before it can be renamed, closing it also tells us whether all data was flushed
+        const bool closed = (fclose(file.release()) == 0);
+        if (!written || !closed || !replaceFile(tempFilename, cacheFilename))
+        {
+            removeFile(tempFilename);
+            return false;
+        }
+
+        return true;
+    }
+}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    Filesystem::Path ImageLoader::m_diskCacheDirectory;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::unique_ptr<std::uint8_t[]> ImageLoader::loadFromFile(const String& filename, Vector2u& imageSize)
     {
-        std::size_t fileSize;
-        auto fileContents = readFileToMemory(filename, fileSize);
-        if (!fileContents)
-            return nullptr;
+        // Try to load the decoded pixels from the disk cache first. Files that can't be found by path (e.g. android assets)
+        // are never cached.
+        Filesystem::FileInfo fileInfo;
+        String cacheFilename;
+        std::string cacheKey;
+        if (!m_diskCacheDirectory.isEmpty() && Filesystem::getFileInfo(Filesystem::Path(filename), fileInfo) && !fileInfo.directory)
+        {
+            Filesystem::Path absolutePath(filename);
+            if (absolutePath.isRelative())
+                absolutePath = Filesystem::getCurrentWorkingDirectory() / absolutePath;
+
+            cacheKey = absolutePath.getNormalForm().asString().toStdString();
+            cacheFilename = (m_diskCacheDirectory / getDiskCacheFilename(cacheKey)).asString();
+
+            auto pixelData = readFromDiskCache(cacheFilename, cacheKey, fileInfo, imageSize);
+            if (pixelData)
+                return pixelData;
+        }
+
+        auto pixelData = decodeFile(filename, imageSize);
+        if (pixelData && !cacheFilename.empty())
+            writeToDiskCache(cacheFilename, cacheKey, fileInfo, pixelData.get(), imageSize);
 
-        return loadFromMemory(fileContents.get(), fileSize, imageSize);
+        return pixelData;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::unique_ptr<std::uint8_t[]> ImageLoader::loadFromMemory(const std::uint8_t* data, std::size_t dataSize, Vector2u& imageSize)
     {
-        std::unique_ptr<std::uint8_t[]> pixelData = nullptr;
-
         int imgWidth;
         int imgHeight;
         int imgChannels;
         stbi_uc* buffer = stbi_load_from_memory(static_cast<const stbi_uc*>(data), static_cast<int>(dataSize), &imgWidth, &imgHeight, &imgChannels, 4);
-        if (!buffer)
-            return pixelData;
+        return takeDecodedPixels(buffer, imgWidth, imgHeight, imageSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ImageLoader::loadImageSizeFromMemory(const std::uint8_t* data, std::size_t dataSize, Vector2u& imageSize)
+    {
+        int imgWidth;
+        int imgHeight;
+        int imgChannels;
+        if (!stbi_info_from_memory(static_cast<const stbi_uc*>(data), static_cast<int>(dataSize), &imgWidth, &imgHeight, &imgChannels))
+            return false;
+
+        if ((imgWidth <= 0) || (imgHeight <= 0))
+            return false;
+
+        imageSize.x = static_cast<unsigned int>(imgWidth);
+        imageSize.y = static_cast<unsigned int>(imgHeight);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        if ((imgWidth > 0) && (imgHeight > 0))
+    bool ImageLoader::loadImageSizeFromFile(const String& filename, Vector2u& imageSize)
+    {
+#ifdef TGUI_SYSTEM_ANDROID
+        // Assets can't be opened like a regular file, they have to be read into memory first
+        if (!filename.empty() && (filename[0] != '/'))
         {
-            const std::size_t pixelDataSize = 4 * static_cast<std::size_t>(imgWidth) * static_cast<std::size_t>(imgHeight);
-            pixelData = MakeUniqueForOverwrite<std::uint8_t[]>(pixelDataSize);
-            std::memcpy(pixelData.get(), buffer, pixelDataSize);
+            std::size_t fileSize;
+            const auto fileContents = readFileToMemory(filename, fileSize);
+            if (!fileContents)
+                return false;
 
-            imageSize.x = static_cast<unsigned int>(imgWidth);
-            imageSize.y = static_cast<unsigned int>(imgHeight);
+            return loadImageSizeFromMemory(fileContents.get(), fileSize, imageSize);
         }
+#endif
 
-        stbi_image_free(buffer);
-        return pixelData;
+        const FilePtr file = openBinaryFile(filename, false);
+        if (!file)
+            return false;
+
+        const stbi_io_callbacks callbacks = {&readFileCallback, &skipFileCallback, &eofFileCallback};
+
+        int imgWidth;
+        int imgHeight;
+        int imgChannels;
+        if (!stbi_info_from_callbacks(&callbacks, file.get(), &imgWidth, &imgHeight, &imgChannels))
+            return false;
+
+        if ((imgWidth <= 0) || (imgHeight <= 0))
+            return false;
+
+        imageSize.x = static_cast<unsigned int>(imgWidth);
+        imageSize.y = static_cast<unsigned int>(imgHeight);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ImageLoader::setDiskCacheDirectory(const Filesystem::Path& directory)
+    {
+        m_diskCacheDirectory = directory;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const Filesystem::Path& ImageLoader::getDiskCacheDirectory()
+    {
+        return m_diskCacheDirectory;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -56,12 +56,12 @@ namespace tgui
 
     float ChildWindowRenderer::getTitleBarHeight() const
     {
-        auto it = m_data->propertyValuePairs.find("TitleBarHeight");
+        auto it = m_data->propertyValuePairs.find(getPropertyName(RendererPropertyId::TitleBarHeight));
         if (it != m_data->propertyValuePairs.end())
             return it->second.getNumber();
         else
         {
-            it = m_data->propertyValuePairs.find("TextureTitleBar");
+            it = m_data->propertyValuePairs.find(getPropertyName(RendererPropertyId::TextureTitleBar));
             if (it != m_data->propertyValuePairs.end() && it->second.getTexture().getData())
                 return static_cast<float>(it->second.getTexture().getImageSize().y);
             else
@@ -73,7 +73,7 @@ namespace tgui
 
     void ChildWindowRenderer::setTitleBarHeight(float number)
     {
-        setProperty("TitleBarHeight", ObjectConverter{number});
+        setProperty(getPropertyName(RendererPropertyId::TitleBarHeight), ObjectConverter{number});
     }
 }
 
@@ -27,10 +27,55 @@
 #include <TGUI/RendererDefines.hpp>
 #include <TGUI/Widget.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <unordered_map>
+    #include <deque>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Hashes the characters of the name in-place, so that looking up a name doesn't need to copy it
+        struct PropertyNameHash
+        {
+            TGUI_NODISCARD std::size_t operator()(const String& name) const
+            {
+                return std::hash<std::u32string>{}(name.toUtf32());
+            }
+        };
+
+        // Global table of interned names. It isn't thread-safe, it should only be accessed from the gui thread.
+        struct PropertyNameInterner
+        {
+            PropertyNameInterner() :
+                names{
+#define TGUI_RENDERER_PROPERTY_NAME_STRING(NAME) #NAME,
+                    TGUI_RENDERER_PROPERTY_NAMES(TGUI_RENDERER_PROPERTY_NAME_STRING)
+#undef TGUI_RENDERER_PROPERTY_NAME_STRING
+                }
+            {
+                TGUI_ASSERT(names.size() == static_cast<std::size_t>(RendererPropertyId::KnownPropertyCount), "Each named property id needs a name");
+
+                ids.reserve(names.size());
+                for (std::size_t i = 0; i < names.size(); ++i)
+                    ids.emplace(names[i], static_cast<RendererPropertyId>(i));
+            }
+
+            std::deque<String> names; // Deque because references to the names may not be invalidated when adding new ones
+            std::unordered_map<String, RendererPropertyId, PropertyNameHash> ids;
+        };
+
+        PropertyNameInterner& getPropertyNameInterner()
+        {
+            static PropertyNameInterner interner;
+            return interner;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     RendererData::RendererData(const RendererData& other) :
@@ -99,7 +144,7 @@ namespace tgui
 
     void WidgetRenderer::setOpacity(float opacity)
     {
-        setProperty("Opacity", ObjectConverter{std::max(0.f, std::min(1.f, opacity))});
+        setProperty(getPropertyName(RendererPropertyId::Opacity), ObjectConverter{std::max(0.f, std::min(1.f, opacity))});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -109,9 +154,9 @@ namespace tgui
     void WidgetRenderer::setOpacityDisabled(float opacity)
     {
         if (opacity != -1.f)
-            setProperty("OpacityDisabled", ObjectConverter{std::max(0.f, std::min(1.f, opacity))});
+            setProperty(getPropertyName(RendererPropertyId::OpacityDisabled), ObjectConverter{std::max(0.f, std::min(1.f, opacity))});
         else
-            setProperty("OpacityDisabled", ObjectConverter{-1.f});
+            setProperty(getPropertyName(RendererPropertyId::OpacityDisabled), ObjectConverter{-1.f});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -145,14 +190,14 @@ namespace tgui
 
     void WidgetRenderer::setFont(const Font& font)
     {
-        setProperty("Font", font);
+        setProperty(getPropertyName(RendererPropertyId::Font), font);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font WidgetRenderer::getFont() const
     {
-        auto it = m_data->propertyValuePairs.find("Font");
+        auto it = m_data->propertyValuePairs.find(getPropertyName(RendererPropertyId::Font));
         if (it != m_data->propertyValuePairs.end())
             return it->second.getFont();
         else
@@ -163,14 +208,14 @@ namespace tgui
 
     void WidgetRenderer::setTextSize(unsigned int size)
     {
-        setProperty("TextSize", static_cast<float>(size));
+        setProperty(getPropertyName(RendererPropertyId::TextSize), static_cast<float>(size));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int WidgetRenderer::getTextSize() const
     {
-        auto it = m_data->propertyValuePairs.find("TextSize");
+        auto it = m_data->propertyValuePairs.find(getPropertyName(RendererPropertyId::TextSize));
         if (it != m_data->propertyValuePairs.end())
             return static_cast<unsigned int>(it->second.getNumber());
         else
@@ -181,11 +226,13 @@ namespace tgui
 
     void WidgetRenderer::setProperty(const String& property, ObjectConverter&& value)
     {
-        if (m_data->propertyValuePairs[property] == value)
+        // Look up the property only once, the nodes of the map remain valid while the observers are being notified
+        ObjectConverter& storedValue = m_data->propertyValuePairs[property];
+        if (storedValue == value)
             return;
 
-        const ObjectConverter oldValue = m_data->propertyValuePairs[property];
-        m_data->propertyValuePairs[property] = value;
+        ObjectConverter oldValue = std::move(storedValue);
+        storedValue = std::move(value);
 
         try
         {
@@ -194,7 +241,7 @@ namespace tgui
         }
         catch (const Exception&)
         {
-            m_data->propertyValuePairs[property] = oldValue;
+            m_data->propertyValuePairs[property] = std::move(oldValue);
             throw;
         }
     }
@@ -219,6 +266,30 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    RendererPropertyId WidgetRenderer::getPropertyId(const String& property)
+    {
+        auto& interner = getPropertyNameInterner();
+        const auto it = interner.ids.find(property);
+        if (it != interner.ids.end())
+            return it->second;
+
+        const auto id = static_cast<RendererPropertyId>(interner.names.size());
+        interner.names.push_back(property);
+        interner.ids.emplace(property, id);
+        return id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const String& WidgetRenderer::getPropertyName(RendererPropertyId id)
+    {
+        const auto& names = getPropertyNameInterner().names;
+        TGUI_ASSERT(static_cast<std::size_t>(id) < names.size(), "WidgetRenderer::getPropertyName called with id that wasn't returned by getPropertyId");
+        return names[static_cast<std::size_t>(id)];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void WidgetRenderer::subscribe(Widget* widget)
     {
         m_data->observers.insert(widget);
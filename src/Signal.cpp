@@ -30,6 +30,8 @@
 
 #include <cassert>
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <iterator>
     #include <set>
 #endif
 
@@ -59,7 +61,7 @@ namespace tgui
         {
             m_enabled = other.m_enabled;
             m_name = other.m_name;
-            m_handlers.clear(); // signal handlers are not copied with the widget
+            disconnectAll(); // signal handlers are not copied with the widget
         }
 
         return *this;
@@ -69,31 +71,125 @@ namespace tgui
 
     bool Signal::disconnect(unsigned int id)
     {
-        return (m_handlers.erase(id) != 0);
+        if (!m_handlers || (id == 0))
+            return false;
+
+        auto& handlers = m_handlers->handlers;
+        const auto it = std::find_if(handlers.begin(), handlers.end(), [id](const Handler& handler){ return handler.id == id; });
+        if (it != handlers.end())
+        {
+            // The handler can't be destroyed while it might still be executing, so it is only removed after the emit finished
+            if (m_handlers->emitDepth > 0)
+            {
+                it->id = 0;
+                m_handlers->containsDisconnectedHandlers = true;
+            }
+            else
+                handlers.erase(it);
+
+            return true;
+        }
+
+        auto& pendingHandlers = m_handlers->pendingHandlers;
+        const auto pendingIt = std::find_if(pendingHandlers.begin(), pendingHandlers.end(), [id](const Handler& handler){ return handler.id == id; });
+        if (pendingIt != pendingHandlers.end())
+        {
+            pendingHandlers.erase(pendingIt);
+            return true;
+        }
+
+        return false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Signal::disconnectAll()
     {
-        m_handlers.clear();
+        if (!m_handlers)
+            return;
+
+        m_handlers->pendingHandlers.clear();
+        if (m_handlers->emitDepth > 0)
+        {
+            for (auto& handler : m_handlers->handlers)
+                handler.id = 0;
+
+            m_handlers->containsDisconnectedHandlers = true;
+        }
+        else
+            m_handlers->handlers.clear();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Signal::emit(const Widget* widget)
     {
-        if (m_handlers.empty() || !m_enabled)
+        if (!m_handlers || !m_enabled)
             return false;
 
         m_parameters[0] = static_cast<const void*>(&widget);
 
-        // Copy the handlers before calling them in case the widget (and this signal) gets destroyed during the handler
-        auto handlers = m_handlers;
-        for (const auto& handler : handlers)
-            handler.second();
+        // Keep a reference to the handlers in case the widget (and this signal) gets destroyed during the handler.
+        // Copying the shared pointer doesn't allocate, unlike copying the handlers themselves.
+        const std::shared_ptr<HandlerList> handlerList = m_handlers;
+
+        // Handlers that are connected or disconnected during the emit are only added or removed when the last emit
+        // finishes, so that the vector isn't reallocated while we are iterating over it.
+        struct EmitGuard
+        {
+            HandlerList& list;
+
+            explicit EmitGuard(HandlerList& l) : list(l) { ++list.emitDepth; }
+            EmitGuard(const EmitGuard&) = delete;
+            EmitGuard& operator=(const EmitGuard&) = delete;
+
+            ~EmitGuard()
+            {
+                if (--list.emitDepth > 0)
+                    return;
+
+                if (list.containsDisconnectedHandlers)
+                {
+                    list.handlers.erase(std::remove_if(list.handlers.begin(), list.handlers.end(),
+                        [](const Handler& handler){ return handler.id == 0; }), list.handlers.end());
+                    list.containsDisconnectedHandlers = false;
+                }
+
+                if (!list.pendingHandlers.empty())
+                {
+                    list.handlers.insert(list.handlers.end(),
+                        std::make_move_iterator(list.pendingHandlers.begin()), std::make_move_iterator(list.pendingHandlers.end()));
+                    list.pendingHandlers.clear();
+                }
+            }
+        } guard{*handlerList};
+
+        bool handlerCalled = false;
+        const std::size_t handlerCount = handlerList->handlers.size();
+        for (std::size_t i = 0; i < handlerCount; ++i)
+        {
+            const Handler& handler = handlerList->handlers[i];
+            if (handler.id == 0)
+                continue;
+
+            handlerCalled = true;
+            handler.func();
+        }
+
+        return handlerCalled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Signal::addHandler(unsigned int id, std::function<void()>&& func)
+    {
+        if (!m_handlers)
+            m_handlers = std::make_shared<HandlerList>();
 
-        return true;
+        if (m_handlers->emitDepth > 0)
+            m_handlers->pendingHandlers.push_back({id, std::move(func)});
+        else
+            m_handlers->handlers.push_back({id, std::move(func)});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -107,7 +203,7 @@ namespace tgui
 
     bool SignalChildWindow::emit(ChildWindow* childWindow)
     {
-        if (m_handlers.empty())
+        if (!hasHandlers())
             return false;
 
         m_parameters[1] = static_cast<const void*>(&childWindow);
@@ -125,7 +221,7 @@ namespace tgui
 
     bool SignalItem::emit(const Widget* widget, int index, const String& item, const String& id)
     {
-        if (m_handlers.empty())
+        if (!hasHandlers())
             return false;
 
         m_parameters[1] = static_cast<const void*>(&index);
@@ -138,7 +234,7 @@ namespace tgui
 
     bool SignalPanelListBoxItem::emit(const Widget* widget, int index, const std::shared_ptr<Panel>& panel, const String& id)
     {
-        if (m_handlers.empty())
+        if (!hasHandlers())
             return false;
 
         m_parameters[1] = static_cast<const void*>(&index);
@@ -158,7 +254,7 @@ namespace tgui
 
     bool SignalFileDialogPaths::emit(const Widget* widget, const std::vector<Filesystem::Path>& paths)
     {
-        if (m_handlers.empty())
+        if (!hasHandlers())
             return false;
 
         assert(!paths.empty());
@@ -173,7 +269,7 @@ namespace tgui
 
     bool SignalShowEffect::emit(const Widget* widget, ShowEffectType type, bool visible)
     {
-        if (m_handlers.empty())
+        if (!hasHandlers())
             return false;
 
         m_parameters[1] = static_cast<const void*>(&type);
@@ -185,7 +281,7 @@ namespace tgui
 
     bool SignalAnimationType::emit(const Widget* widget, AnimationType type)
     {
-        if (m_handlers.empty())
+        if (!hasHandlers())
             return false;
 
         m_parameters[1] = static_cast<const void*>(&type);
@@ -196,7 +292,7 @@ namespace tgui
 
     bool SignalItemHierarchy::emit(const Widget* widget, const String& item, const std::vector<String>& fullItem)
     {
-        if (m_handlers.empty())
+        if (!hasHandlers())
             return false;
 
         m_parameters[1] = static_cast<const void*>(&item);
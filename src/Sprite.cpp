@@ -26,9 +26,11 @@
 #include <TGUI/Sprite.hpp>
 #include <TGUI/Color.hpp>
 #include <TGUI/Optional.hpp>
+#include <TGUI/TextureManager.hpp>
 #include <TGUI/Backend/Window/Backend.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
     #include <cmath>
 #endif
 
@@ -47,6 +49,8 @@ namespace tgui
         m_size       (other.m_size),
         m_texture    (other.m_texture),
         m_svgTexture (nullptr),
+        m_svgStaleTexture(nullptr),
+        m_downscaledTexture(other.m_downscaledTexture),
         m_vertices   (other.m_vertices),
         m_indices    (other.m_indices),
         m_visibleRect(other.m_visibleRect),
@@ -66,6 +70,8 @@ namespace tgui
         m_size       (std::move(other.m_size)),
         m_texture    (std::move(other.m_texture)),
         m_svgTexture (std::move(other.m_svgTexture)),
+        m_svgStaleTexture(std::move(other.m_svgStaleTexture)),
+        m_downscaledTexture(std::move(other.m_downscaledTexture)),
         m_vertices   (std::move(other.m_vertices)),
         m_indices    (std::move(other.m_indices)),
         m_visibleRect(std::move(other.m_visibleRect)),
@@ -88,6 +94,8 @@ namespace tgui
             std::swap(m_size,        temp.m_size);
             std::swap(m_texture,     temp.m_texture);
             std::swap(m_svgTexture,  temp.m_svgTexture);
+            std::swap(m_svgStaleTexture, temp.m_svgStaleTexture);
+            std::swap(m_downscaledTexture, temp.m_downscaledTexture);
             std::swap(m_vertices,    temp.m_vertices);
             std::swap(m_indices,     temp.m_indices);
             std::swap(m_visibleRect, temp.m_visibleRect);
@@ -110,6 +118,8 @@ namespace tgui
             m_size        = std::move(other.m_size);
             m_texture     = std::move(other.m_texture);
             m_svgTexture  = std::move(other.m_svgTexture);
+            m_svgStaleTexture = std::move(other.m_svgStaleTexture);
+            m_downscaledTexture = std::move(other.m_downscaledTexture);
             m_vertices    = std::move(other.m_vertices);
             m_indices     = std::move(other.m_indices);
             m_visibleRect = std::move(other.m_visibleRect);
@@ -354,29 +364,67 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    const std::shared_ptr<BackendTexture>& Sprite::getSvgTexture() const
+    {
+        if (m_svgStaleTexture && (m_svgTexture->getSize() == Vector2u{}))
+            return m_svgStaleTexture;
+        else
+            return m_svgTexture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::shared_ptr<BackendTexture>& Sprite::getDownscaledTexture() const
+    {
+        return m_downscaledTexture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Sprite::updateVertices()
     {
+        m_downscaledTexture = nullptr;
+
         // Figure out how the image is scaled best
         Vector2f textureSize;
         FloatRect middleRect;
         Vector2u texCoordOffset;
         if (m_texture.getData()->svgImage)
         {
-            if (!m_svgTexture)
-                m_svgTexture = getBackend()->createTexture();
-
             const Vector2u svgTextureSize{
                 static_cast<unsigned int>(std::round(getSize().x)),
                 static_cast<unsigned int>(std::round(getSize().y))};
 
-            m_texture.getData()->svgImage->rasterize(*m_svgTexture, svgTextureSize);
+            // The texture is shared with all other sprites that show the same image at the same size
+            SvgImage& svgImage = *m_texture.getData()->svgImage;
+            if (SvgImage::getBackgroundRasterization())
+            {
+                // The texture that is currently shown remains in use until the image has been rasterized at the new size.
+                // If nothing has been shown yet then the image is rasterized immediately.
+                const Vector2u rasterSize = SvgImage::getRasterizationBucketSize(svgTextureSize);
+                std::shared_ptr<BackendTexture> shownTexture = getSvgTexture();
+                if (shownTexture && (shownTexture->getSize() != Vector2u{}))
+                    m_svgTexture = svgImage.getRasterizedTextureAsync(rasterSize);
+                else
+                    m_svgTexture = svgImage.getRasterizedTexture(rasterSize);
+
+                if (m_svgTexture->getSize() == Vector2u{})
+                    m_svgStaleTexture = std::move(shownTexture);
+                else
+                    m_svgStaleTexture = nullptr;
+            }
+            else
+            {
+                m_svgTexture = svgImage.getRasterizedTexture(svgTextureSize);
+                m_svgStaleTexture = nullptr;
+            }
 
             m_scalingType = ScalingType::Normal;
             textureSize = getSize();
         }
         else
         {
-            texCoordOffset = m_texture.getPartRect().getPosition();
+            texCoordOffset = m_texture.getPartRect().getPosition() + m_texture.getData()->atlasRect.getPosition();
             textureSize = Vector2f{m_texture.getPartRect().getSize()};
             middleRect = FloatRect{m_texture.getMiddleRect()};
             if (middleRect == FloatRect(0, 0, textureSize.x, textureSize.y))
@@ -411,6 +459,18 @@ namespace tgui
                 else
                     m_scalingType = ScalingType::Normal;
             }
+
+            // When the image is drawn much smaller than its size, a smaller copy of the image can be drawn instead
+            if ((m_scalingType == ScalingType::Normal) && TextureManager::getDownscalingEnabled() && (m_size.x > 0) && (m_size.y > 0))
+            {
+                const float scale = std::min(textureSize.x / m_size.x, textureSize.y / m_size.y);
+                unsigned int factor = 1;
+                while ((factor < 1024) && (static_cast<float>(2 * factor) <= scale))
+                    factor *= 2;
+
+                if (factor > 1)
+                    m_downscaledTexture = TextureManager::getDownscaledTexture(*m_texture.getData(), factor);
+            }
         }
 
         // Calculate the vertices based on the way we are scaling
@@ -550,8 +610,8 @@ namespace tgui
         {
             for (auto& vertex : m_vertices)
             {
-                vertex.texCoords.x += static_cast<float>(m_texture.getPartRect().left);
-                vertex.texCoords.y += static_cast<float>(m_texture.getPartRect().top);
+                vertex.texCoords.x += static_cast<float>(texCoordOffset.x);
+                vertex.texCoords.y += static_cast<float>(texCoordOffset.y);
             }
         }
 
@@ -35,6 +35,7 @@ namespace tgui
         Widget{typeName, initRenderer}
     {
         m_draggableWidget = true;
+        m_hitAreaLimitedToSize = false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -342,6 +343,9 @@ namespace tgui
     {
         Widget::setParent(parent);
         m_container->setParentGui(m_parentGui);
+
+        // Changes to the subwidgets need to invalidate the name index of the container in which this widget is placed
+        static_cast<Container&>(*m_container).m_nameIndexParent = parent;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,6 +26,18 @@
 #include <TGUI/Global.hpp>
 #include <TGUI/SvgImage.hpp>
 #include <TGUI/Backend/Renderer/BackendTexture.hpp>
+#include <TGUI/Backend/Window/Backend.hpp>
+
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <atomic>
+    #include <deque>
+    #include <list>
+    #include <mutex>
+    #include <thread>
+    #include <unordered_map>
+    #include <vector>
+#endif
 
 #if defined(__GNUC__)
 #   pragma GCC diagnostic push
@@ -86,6 +98,8 @@
     // We place the functions in a namespace to prevent potential issues if the TGUI user also uses nanosvg in their own project.
     // We don't use an anonymous namespace as it leads to a warning from some compilers because SvgImageData (which has to be
     // forward declared in the header file and can't be anonymous) would have public members that have static linkage.
+    using tgui::priv::NSVGimage;
+    using tgui::priv::NSVGrasterizer;
     using tgui::priv::nsvgParseFromFile;
     using tgui::priv::nsvgDelete;
     using tgui::priv::nsvgCreateRasterizer;
@@ -111,11 +125,203 @@ namespace tgui
     {
         struct SvgImageData
         {
+            // The parsed image may outlive the SvgImage while a worker thread is still rasterizing it
+            ~SvgImageData()
+            {
+                if (rasterizer)
+                    nsvgDeleteRasterizer(rasterizer);
+                if (svg)
+                    nsvgDelete(svg);
+            }
+
             NSVGimage* svg = nullptr;
             NSVGrasterizer* rasterizer = nullptr;
         };
     }
 
+    namespace
+    {
+        // The rasterizer can't be shared between threads, but the parsed image is only read while rasterizing
+        std::unique_ptr<unsigned char[]> rasterizeSvg(NSVGrasterizer* rasterizer, NSVGimage* svg, Vector2u size)
+        {
+            const float scaleX = size.x / static_cast<float>(svg->width);
+            const float scaleY = size.y / static_cast<float>(svg->height);
+
+            auto pixels = MakeUniqueForOverwrite<unsigned char[]>(size.x * size.y * 4);
+            nsvgRasterizeXY(rasterizer, svg, 0, 0, scaleX, scaleY,
+                            pixels.get(), static_cast<int>(size.x), static_cast<int>(size.y), static_cast<int>(size.x * 4));
+            return pixels;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // An image that is being rasterized by a worker thread
+        struct SvgRasterization
+        {
+            // The texture isn't kept alive, the image isn't rasterized when the texture is no longer needed by then
+            std::shared_ptr<priv::SvgImageData> image;
+            std::weak_ptr<BackendTexture> texture;
+            Vector2u size;
+
+            // Only accessed by the worker thread until finished is set
+            std::unique_ptr<unsigned char[]> pixels;
+            std::atomic<bool> finished{false};
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // The worker threads are detached and keep the queue alive themselves, they stop when there is nothing left to do
+        struct SvgRasterizationQueue
+        {
+            std::deque<std::shared_ptr<SvgRasterization>> rasterizations;
+            unsigned int runningThreads = 0;
+            std::mutex mutex;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Called within a separate thread, which uses its own rasterizer
+        void rasterizeQueuedImages(const std::shared_ptr<SvgRasterizationQueue>& queue)
+        {
+            auto* rasterizer = nsvgCreateRasterizer();
+            while (true)
+            {
+                std::shared_ptr<SvgRasterization> rasterization;
+                {
+                    std::lock_guard<std::mutex> lock(queue->mutex);
+                    if (queue->rasterizations.empty())
+                    {
+                        --queue->runningThreads;
+                        break;
+                    }
+
+                    rasterization = std::move(queue->rasterizations.front());
+                    queue->rasterizations.pop_front();
+                }
+
+                if (!rasterization->texture.expired())
+                    rasterization->pixels = rasterizeSvg(rasterizer, rasterization->image->svg, rasterization->size);
+
+                rasterization->finished = true;
+            }
+
+            nsvgDeleteRasterizer(rasterizer);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        const auto svgRasterizationQueue = std::make_shared<SvgRasterizationQueue>();
+        std::vector<std::shared_ptr<SvgRasterization>> svgRasterizations;
+        bool svgBackgroundRasterization = false;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        struct SvgRasterCacheKey
+        {
+            const priv::SvgImageData* image;
+            Vector2u size;
+
+            TGUI_NODISCARD bool operator==(const SvgRasterCacheKey& other) const
+            {
+                return (image == other.image) && (size == other.size);
+            }
+        };
+
+        struct SvgRasterCacheKeyHash
+        {
+            TGUI_NODISCARD std::size_t operator()(const SvgRasterCacheKey& key) const
+            {
+                const std::uint64_t size = (static_cast<std::uint64_t>(key.size.x) << 32) | key.size.y;
+                return std::hash<const priv::SvgImageData*>{}(key.image) ^ (std::hash<std::uint64_t>{}(size) << 1);
+            }
+        };
+
+        struct SvgRasterCacheEntry
+        {
+            // The cache owns the texture. The pointers that are handed out have their own reference count, so that the
+            // cache is notified when the last user releases the texture instead of having to check all entries.
+            std::shared_ptr<BackendTexture> texture;
+            std::weak_ptr<BackendTexture> userTexture;
+
+            // Position in the list of unused textures, only valid while the texture isn't used
+            std::list<SvgRasterCacheKey>::iterator unusedIt;
+            bool unused = false;
+        };
+
+        // The released textures are kept in the cache until there are too many of them, the textures that were released
+        // the longest time ago are removed first. The most recently released textures are at the front of the list.
+        struct SvgRasterCache
+        {
+            std::unordered_map<SvgRasterCacheKey, SvgRasterCacheEntry, SvgRasterCacheKeyHash> entries;
+            std::list<SvgRasterCacheKey> unusedKeys;
+            std::size_t limit = 32;
+        };
+
+        // The textures that are handed out only keep a weak pointer to the cache, as they may outlive it
+        const auto svgRasterCache = std::make_shared<SvgRasterCache>();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void removeUnusedRasterizedTextures()
+        {
+            while (svgRasterCache->unusedKeys.size() > svgRasterCache->limit)
+            {
+                svgRasterCache->entries.erase(svgRasterCache->unusedKeys.back());
+                svgRasterCache->unusedKeys.pop_back();
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Called when the last user of a cached texture releases it
+        void releaseRasterizedTexture(const std::weak_ptr<SvgRasterCache>& weakCache, const SvgRasterCacheKey& key, const BackendTexture* texture)
+        {
+            const auto cache = weakCache.lock();
+            if (!cache)
+                return;
+
+            // The texture may have already been removed from the cache, e.g. because the image was destroyed
+            const auto it = cache->entries.find(key);
+            if ((it == cache->entries.end()) || (it->second.texture.get() != texture))
+                return;
+
+            // Unused textures that are still being rasterized are always removed, so that the worker threads can skip them
+            if (texture->getSize() == Vector2u{})
+            {
+                cache->entries.erase(it);
+                return;
+            }
+
+            cache->unusedKeys.push_front(key);
+            it->second.unusedIt = cache->unusedKeys.begin();
+            it->second.unused = true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns a pointer to the cached texture that notifies the cache when it is no longer used
+        std::shared_ptr<BackendTexture> useRasterizedTexture(const SvgRasterCacheKey& key, SvgRasterCacheEntry& entry)
+        {
+            if (auto userTexture = entry.userTexture.lock())
+                return userTexture;
+
+            if (entry.unused)
+            {
+                svgRasterCache->unusedKeys.erase(entry.unusedIt);
+                entry.unused = false;
+            }
+
+            const std::weak_ptr<SvgRasterCache> weakCache = svgRasterCache;
+            const std::shared_ptr<BackendTexture> texture = entry.texture;
+            std::shared_ptr<BackendTexture> userTexture(texture.get(), [weakCache,key,texture](BackendTexture*){
+                releaseRasterizedTexture(weakCache, key, texture.get());
+            });
+
+            entry.userTexture = userTexture;
+            return userTexture;
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     SvgImage::SvgImage() :
@@ -139,10 +345,19 @@ namespace tgui
 
     SvgImage::~SvgImage()
     {
-        if (m_data->rasterizer)
-            nsvgDeleteRasterizer(m_data->rasterizer);
-        if (m_data->svg)
-            nsvgDelete(m_data->svg);
+        for (auto it = svgRasterCache->entries.begin(); it != svgRasterCache->entries.end();)
+        {
+            if (it->first.image != m_data.get())
+            {
+                ++it;
+                continue;
+            }
+
+            if (it->second.unused)
+                svgRasterCache->unusedKeys.erase(it->second.unusedIt);
+
+            it = svgRasterCache->entries.erase(it);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -172,14 +387,169 @@ namespace tgui
         if (!m_data->rasterizer)
             m_data->rasterizer = nsvgCreateRasterizer();
 
-        const float scaleX = size.x / static_cast<float>(m_data->svg->width);
-        const float scaleY = size.y / static_cast<float>(m_data->svg->height);
+        texture.load(size, rasterizeSvg(m_data->rasterizer, m_data->svg, size), true);
+    }
 
-        auto pixels = MakeUniqueForOverwrite<unsigned char[]>(size.x * size.y * 4);
-        nsvgRasterizeXY(m_data->rasterizer, m_data->svg, 0, 0, scaleX, scaleY,
-                        pixels.get(), static_cast<int>(size.x), static_cast<int>(size.y), static_cast<int>(size.x * 4));
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        texture.load(size, std::move(pixels), true);
+    std::shared_ptr<BackendTexture> SvgImage::getRasterizedTexture(Vector2u size)
+    {
+        // There is nothing to share when there is nothing to draw
+        if (!m_data->svg || (size.x == 0) || (size.y == 0))
+            return getBackend()->createTexture();
+
+        const SvgRasterCacheKey key{m_data.get(), size};
+        const auto it = svgRasterCache->entries.find(key);
+        if (it != svgRasterCache->entries.end())
+        {
+            // If the texture is still being rasterized in the background then we can't wait for it
+            if (it->second.texture->getSize() == Vector2u{})
+                rasterize(*it->second.texture, size);
+
+            return useRasterizedTexture(key, it->second);
+        }
+
+        auto& entry = svgRasterCache->entries[key];
+        entry.texture = getBackend()->createTexture();
+        rasterize(*entry.texture, size);
+
+        auto texture = useRasterizedTexture(key, entry);
+        removeUnusedRasterizedTextures();
+        return texture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BackendTexture> SvgImage::getRasterizedTextureAsync(Vector2u size)
+    {
+        if (!m_data->svg || (size.x == 0) || (size.y == 0))
+            return getBackend()->createTexture();
+
+        const SvgRasterCacheKey key{m_data.get(), size};
+        const auto it = svgRasterCache->entries.find(key);
+        if (it != svgRasterCache->entries.end())
+            return useRasterizedTexture(key, it->second);
+
+        auto& entry = svgRasterCache->entries[key];
+        entry.texture = getBackend()->createTexture();
+        auto texture = useRasterizedTexture(key, entry);
+
+        auto rasterization = std::make_shared<SvgRasterization>();
+        rasterization->image = m_data;
+        rasterization->texture = texture;
+        rasterization->size = size;
+        svgRasterizations.push_back(rasterization);
+
+        {
+            std::lock_guard<std::mutex> lock(svgRasterizationQueue->mutex);
+            svgRasterizationQueue->rasterizations.push_back(std::move(rasterization));
+
+            const unsigned int maxThreads = std::max(1u, std::min(4u, std::thread::hardware_concurrency()));
+            if (svgRasterizationQueue->runningThreads < maxThreads)
+            {
+                ++svgRasterizationQueue->runningThreads;
+                std::thread(&rasterizeQueuedImages, svgRasterizationQueue).detach();
+            }
+        }
+
+        removeUnusedRasterizedTextures();
+        return texture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool SvgImage::processBackgroundRasterizations()
+    {
+        bool texturesUpdated = false;
+        for (auto it = svgRasterizations.begin(); it != svgRasterizations.end();)
+        {
+            SvgRasterization& rasterization = **it;
+            if (!rasterization.finished)
+            {
+                ++it;
+                continue;
+            }
+
+            // The texture may already have been rasterized synchronously or it may no longer be needed
+            const auto texture = rasterization.texture.lock();
+            if (texture && rasterization.pixels && (texture->getSize() == Vector2u{}))
+            {
+                // The remaining images are uploaded in a later frame when this frame already uploaded too much
+                const std::size_t byteCount = 4 * static_cast<std::size_t>(rasterization.size.x) * rasterization.size.y;
+                if (texturesUpdated && !BackendTexture::isWithinUploadBudget(byteCount))
+                    break;
+
+                texture->load(rasterization.size, std::move(rasterization.pixels), true);
+                texturesUpdated = true;
+            }
+
+            it = svgRasterizations.erase(it);
+        }
+
+        return texturesUpdated;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t SvgImage::getBackgroundRasterizationCount()
+    {
+        return svgRasterizations.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SvgImage::setBackgroundRasterization(bool enabled)
+    {
+        svgBackgroundRasterization = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool SvgImage::getBackgroundRasterization()
+    {
+        return svgBackgroundRasterization;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2u SvgImage::getRasterizationBucketSize(Vector2u size)
+    {
+        // Small sizes are kept exact, larger sizes are rounded up to a multiple of 1/8th of the largest power of two below them.
+        // The image is thus rasterized at most 12.5% larger than it is drawn.
+        const auto roundUp = [](unsigned int value) {
+            if (value <= 16)
+                return value;
+
+            unsigned int step = 1;
+            while ((step << 4) <= value)
+                step <<= 1;
+
+            return ((value + step - 1) / step) * step;
+        };
+
+        return {roundUp(size.x), roundUp(size.y)};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SvgImage::setRasterizationCacheLimit(std::size_t maxUnusedTextures)
+    {
+        svgRasterCache->limit = maxUnusedTextures;
+        removeUnusedRasterizedTextures();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t SvgImage::getRasterizationCacheLimit()
+    {
+        return svgRasterCache->limit;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t SvgImage::getRasterizationCacheSize()
+    {
+        return svgRasterCache->entries.size();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
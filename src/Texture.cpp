@@ -210,6 +210,52 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Texture::loadAsync(const String& id, const AsyncLoadCallbackFunc& onLoaded, const UIntRect& partRect, const UIntRect& middleRect, bool smooth)
+    {
+        // The image can only be decoded in the background when the default texture loader is used
+        using DefaultTextureLoaderFunc = std::shared_ptr<TextureData>(*)(Texture&, const String&, bool);
+        const auto* textureLoader = m_textureLoader.target<DefaultTextureLoaderFunc>();
+        if (id.empty() || !textureLoader || (*textureLoader != &TextureManager::getTexture))
+        {
+            load(id, partRect, middleRect, smooth);
+            if (onLoaded && !id.empty())
+                onLoaded(true);
+
+            return;
+        }
+
+        if (getData() && (m_destructCallback != nullptr))
+        {
+            m_destructCallback(getData());
+            m_destructCallback = nullptr;
+        }
+
+        m_data = nullptr;
+
+        String filename;
+#ifdef TGUI_SYSTEM_WINDOWS
+        if ((id[0] != '/') && (id[0] != '\\') && ((id.length() <= 1) || (id[1] != ':')))
+#else
+        if (id[0] != '/')
+#endif
+            filename = (getResourcePath() / id).asString();
+        else
+            filename = id;
+
+        std::shared_ptr<TextureData> data = TextureManager::getTextureAsync(*this, filename, smooth, onLoaded);
+        if (!data)
+            throw Exception{U"Failed to load '" + filename + U"'"};
+
+        m_id = id;
+        setTextureData(data, partRect, middleRect);
+
+        // If the image didn't have to be decoded in the background then the callback won't be called by the texture manager
+        if (onLoaded && !data->loading)
+            onLoaded(true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 #if TGUI_HAS_RENDERER_BACKEND_SFML_GRAPHICS
     void Texture::load(const sf::Texture& texture, const UIntRect& partRect, const UIntRect& middleRect)
     {
@@ -313,6 +359,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Texture::isLoading() const
+    {
+        return m_data && m_data->loading;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Texture::setColor(const Color& color)
     {
         m_color = color;
@@ -356,7 +409,8 @@ namespace tgui
         const UIntRect& partRect = getPartRect();
         TGUI_ASSERT(pixel.x < partRect.width && pixel.y < partRect.height, "Texture::isTransparentPixel called with pixel outside texture rectangle");
 
-        return m_data->backendTexture->isTransparentPixel({pixel.x + partRect.left, pixel.y + partRect.top});
+        const UIntRect& atlasRect = m_data->atlasRect;
+        return m_data->backendTexture->isTransparentPixel({pixel.x + partRect.left + atlasRect.left, pixel.y + partRect.top + atlasRect.top});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -453,6 +507,8 @@ namespace tgui
         {
             if (m_data->svgImage)
                 m_partRect = {0, 0, static_cast<unsigned int>(m_data->svgImage->getSize().x), static_cast<unsigned int>(m_data->svgImage->getSize().y)};
+            else if (m_data->atlasRect != UIntRect{})
+                m_partRect = {0, 0, m_data->atlasRect.width, m_data->atlasRect.height};
             else
             {
                 const Vector2u textureSize = m_data->backendTexture->getSize();
@@ -26,13 +26,375 @@
 #include <TGUI/TextureManager.hpp>
 #include <TGUI/Texture.hpp>
 #include <TGUI/Backend/Window/Backend.hpp>
+#include <TGUI/Loading/ImageLoader.hpp>
 #include <TGUI/Exception.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <atomic>
+    #include <deque>
+    #include <mutex>
+    #include <thread>
+    #include <vector>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // An image that is being loaded by TextureManager::getTextureAsync
+        struct AsyncTextureLoad
+        {
+            // Only accessed by the main thread. The texture data isn't kept alive, if all textures using it are destroyed
+            // before the image is decoded then the decoded pixels are simply discarded.
+            std::weak_ptr<TextureData> data;
+            std::vector<std::function<void(bool)>> callbacks;
+            bool smooth = true;
+
+            // Only accessed by the worker thread until decoded is set
+            String filename;
+            std::unique_ptr<std::uint8_t[]> pixels;
+            Vector2u imageSize;
+            std::atomic<bool> decoded{false};
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Queue of images that still have to be decoded by the worker threads. The worker threads are detached and keep the
+        // queue alive themselves, so that nothing has to be joined when the program exits while images are being decoded.
+        struct AsyncImageDecodeQueue
+        {
+            std::deque<std::shared_ptr<AsyncTextureLoad>> loads;
+            unsigned int runningThreads = 0;
+            std::mutex mutex;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Called within a separate thread. The thread stops as soon as there are no more images left to decode.
+        void decodeQueuedImages(const std::shared_ptr<AsyncImageDecodeQueue>& queue)
+        {
+            while (true)
+            {
+                std::shared_ptr<AsyncTextureLoad> load;
+                {
+                    std::lock_guard<std::mutex> lock(queue->mutex);
+                    if (queue->loads.empty())
+                    {
+                        --queue->runningThreads;
+                        return;
+                    }
+
+                    load = std::move(queue->loads.front());
+                    queue->loads.pop_front();
+                }
+
+                // The image is decoded in the same way as synchronous loads, so that it uses the disk cache when it is enabled
+                load->pixels = ImageLoader::loadFromFile(load->filename, load->imageSize);
+                load->decoded = true;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void decodeImageAsync(const std::shared_ptr<AsyncImageDecodeQueue>& queue, std::shared_ptr<AsyncTextureLoad> load)
+        {
+            std::lock_guard<std::mutex> lock(queue->mutex);
+            queue->loads.push_back(std::move(load));
+
+            const unsigned int maxThreads = std::max(1u, std::min(4u, std::thread::hardware_concurrency()));
+            if (queue->runningThreads < maxThreads)
+            {
+                ++queue->runningThreads;
+                std::thread(&decodeQueuedImages, queue).detach();
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        const auto asyncImageDecodeQueue = std::make_shared<AsyncImageDecodeQueue>();
+        std::vector<std::shared_ptr<AsyncTextureLoad>> asyncTextureLoads;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // A texture in which small images are packed. Images are placed next to each other on shelves, which are rows with
+        // the height of the first image that was placed in them. Space isn't reused, the page is only removed when it is empty.
+        struct TextureAtlasPage
+        {
+            struct Shelf
+            {
+                unsigned int top = 0;
+                unsigned int height = 0;
+                unsigned int usedWidth = 0;
+            };
+
+            std::shared_ptr<BackendTexture> backendTexture;
+            std::vector<Shelf> shelves;
+            unsigned int imageCount = 0;
+            bool smooth = true;
+        };
+
+        constexpr unsigned int textureAtlasPageSize = 1024;
+        std::vector<TextureAtlasPage> textureAtlasPages;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool allocateInAtlasPage(TextureAtlasPage& page, Vector2u size, Vector2u& position)
+        {
+            // Use the first shelf that has room left, unless the image would waste more than a quarter of the shelf height
+            for (auto& shelf : page.shelves)
+            {
+                if ((size.y <= shelf.height) && (size.y * 4 >= shelf.height * 3) && (shelf.usedWidth + size.x <= textureAtlasPageSize))
+                {
+                    position = {shelf.usedWidth, shelf.top};
+                    shelf.usedWidth += size.x;
+                    return true;
+                }
+            }
+
+            // Start a new shelf below the existing ones
+            const unsigned int top = page.shelves.empty() ? 0 : (page.shelves.back().top + page.shelves.back().height);
+            if ((top + size.y > textureAtlasPageSize) || (size.x > textureAtlasPageSize))
+                return false;
+
+            page.shelves.push_back({top, size.y, size.x});
+            position = {0, top};
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Copies the image into an atlas page. Returns false if the image couldn't be placed in the atlas.
+        bool addImageToAtlas(TextureData& data, const BackendTexture& image, bool smooth)
+        {
+            // The image is surrounded by a border of 1 pixel which repeats the edge pixels of the image, so that texture
+            // filtering near the edge of the image doesn't mix its pixels with those of the neighbouring image.
+            const Vector2u imageSize = image.getSize();
+            const Vector2u paddedSize = {imageSize.x + 2, imageSize.y + 2};
+
+            TextureAtlasPage* page = nullptr;
+            Vector2u position;
+            for (auto& existingPage : textureAtlasPages)
+            {
+                if ((existingPage.smooth == smooth) && allocateInAtlasPage(existingPage, paddedSize, position))
+                {
+                    page = &existingPage;
+                    break;
+                }
+            }
+
+            if (!page)
+            {
+                TextureAtlasPage newPage;
+                newPage.smooth = smooth;
+                newPage.backendTexture = getBackend()->createTexture();
+
+                // Backends that can't update part of a texture re-upload the pixels that are stored in the texture, so the
+                // page always has to keep its pixels, independent of the default pixel storage.
+                newPage.backendTexture->setPixelStorage(BackendTexture::PixelStorage::Full);
+
+                // The page is updated each time an image is added to it and its images lie right next to each other, so it
+                // shouldn't have mipmaps that would have to be regenerated on every update and that would mix the images.
+                newPage.backendTexture->setMipmapsAllowed(false);
+
+                const std::size_t pageByteCount = 4 * static_cast<std::size_t>(textureAtlasPageSize) * textureAtlasPageSize;
+                if (!newPage.backendTexture->load({textureAtlasPageSize, textureAtlasPageSize}, std::make_unique<std::uint8_t[]>(pageByteCount), smooth))
+                    return false;
+
+                if (!allocateInAtlasPage(newPage, paddedSize, position))
+                    return false;
+
+                textureAtlasPages.push_back(std::move(newPage));
+                page = &textureAtlasPages.back();
+            }
+
+            const std::uint8_t* imagePixels = image.getPixels();
+            std::vector<std::uint8_t> paddedPixels(4 * static_cast<std::size_t>(paddedSize.x) * paddedSize.y);
+            for (unsigned int y = 0; y < paddedSize.y; ++y)
+            {
+                const unsigned int srcY = std::min(std::max(y, 1u) - 1, imageSize.y - 1);
+                for (unsigned int x = 0; x < paddedSize.x; ++x)
+                {
+                    const unsigned int srcX = std::min(std::max(x, 1u) - 1, imageSize.x - 1);
+                    const std::size_t srcIndex = 4 * (static_cast<std::size_t>(srcY) * imageSize.x + srcX);
+                    const std::size_t dstIndex = 4 * (static_cast<std::size_t>(y) * paddedSize.x + x);
+                    std::copy(&imagePixels[srcIndex], &imagePixels[srcIndex + 4], &paddedPixels[dstIndex]);
+                }
+            }
+
+            if (!page->backendTexture->update({position.x, position.y, paddedSize.x, paddedSize.y}, paddedPixels.data()))
+            {
+                // The space that was allocated is lost, but the page is still removed once it has no other images
+                if (page->imageCount == 0)
+                    textureAtlasPages.erase(textureAtlasPages.begin() + (page - textureAtlasPages.data()));
+                return false;
+            }
+
+            ++page->imageCount;
+            data.backendTexture = page->backendTexture;
+            data.atlasRect = {position.x + 1, position.y + 1, imageSize.x, imageSize.y};
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void removeImageFromAtlas(const TextureData& data)
+        {
+            for (auto pageIt = textureAtlasPages.begin(); pageIt != textureAtlasPages.end(); ++pageIt)
+            {
+                if (pageIt->backendTexture != data.backendTexture)
+                    continue;
+
+                if (--(pageIt->imageCount) == 0)
+                    textureAtlasPages.erase(pageIt);
+                return;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        using ImageMap = std::map<String, std::list<TextureDataHolder>>;
+
+        // Images that are no longer used but that remain cached, the most recently released images are at the front.
+        // Their total amount of pixel data is kept up-to-date, so that checking the budget doesn't require visiting all images.
+        std::list<TextureDataHolder*> unusedImages;
+        std::size_t unusedImageBytes = 0;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns the amount of pixel data that the image occupies in memory. Svg images aren't rasterized by the texture manager.
+        std::size_t getImageByteCount(const TextureData& data)
+        {
+            if (!data.backendTexture)
+                return 0;
+
+            const Vector2u size = (data.atlasRect != UIntRect{}) ? data.atlasRect.getSize() : data.backendTexture->getSize();
+            std::size_t byteCount = 4 * static_cast<std::size_t>(size.x) * size.y;
+
+            for (const auto& pair : data.downscaledTextures)
+            {
+                const Vector2u downscaledSize = pair.second->getSize();
+                byteCount += 4 * static_cast<std::size_t>(downscaledSize.x) * downscaledSize.y;
+            }
+
+            return byteCount;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Shrinks the image with a box filter. Each pixel of the new image is the average of the pixels that it covers in the
+        // original image, weighted by their alpha so that the color of transparent pixels doesn't bleed into the result.
+        std::unique_ptr<std::uint8_t[]> downscalePixels(const std::uint8_t* pixels, Vector2u size, Vector2u newSize)
+        {
+            auto newPixels = MakeUniqueForOverwrite<std::uint8_t[]>(4 * static_cast<std::size_t>(newSize.x) * newSize.y);
+            for (unsigned int y = 0; y < newSize.y; ++y)
+            {
+                const unsigned int top = static_cast<unsigned int>(static_cast<std::uint64_t>(y) * size.y / newSize.y);
+                const unsigned int bottom = std::max(top + 1, static_cast<unsigned int>(static_cast<std::uint64_t>(y + 1) * size.y / newSize.y));
+                for (unsigned int x = 0; x < newSize.x; ++x)
+                {
+                    const unsigned int left = static_cast<unsigned int>(static_cast<std::uint64_t>(x) * size.x / newSize.x);
+                    const unsigned int right = std::max(left + 1, static_cast<unsigned int>(static_cast<std::uint64_t>(x + 1) * size.x / newSize.x));
+
+                    std::uint64_t sum[4] = {0, 0, 0, 0};
+                    for (unsigned int srcY = top; srcY < bottom; ++srcY)
+                    {
+                        const std::uint8_t* pixel = &pixels[4 * (static_cast<std::size_t>(srcY) * size.x + left)];
+                        for (unsigned int srcX = left; srcX < right; ++srcX, pixel += 4)
+                        {
+                            sum[0] += static_cast<std::uint64_t>(pixel[0]) * pixel[3];
+                            sum[1] += static_cast<std::uint64_t>(pixel[1]) * pixel[3];
+                            sum[2] += static_cast<std::uint64_t>(pixel[2]) * pixel[3];
+                            sum[3] += pixel[3];
+                        }
+                    }
+
+                    const std::uint64_t count = static_cast<std::uint64_t>(right - left) * (bottom - top);
+                    std::uint8_t* newPixel = &newPixels[4 * (static_cast<std::size_t>(y) * newSize.x + x)];
+                    for (unsigned int i = 0; i < 3; ++i)
+                        newPixel[i] = static_cast<std::uint8_t>((sum[3] > 0) ? ((sum[i] + sum[3] / 2) / sum[3]) : 0);
+                    newPixel[3] = static_cast<std::uint8_t>((sum[3] + count / 2) / count);
+                }
+            }
+
+            return newPixels;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Removes the image from memory. The iterators are no longer valid afterwards.
+        void eraseImage(ImageMap& imageMap, ImageMap::iterator imageIt, std::list<TextureDataHolder>::iterator dataIt)
+        {
+            if (dataIt->data->atlasRect != UIntRect{})
+                removeImageFromAtlas(*dataIt->data);
+
+            imageIt->second.erase(dataIt);
+            if (imageIt->second.empty())
+                imageMap.erase(imageIt);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Keeps the image in memory after its last user released it
+        void addUnusedImage(TextureDataHolder& dataHolder)
+        {
+            unusedImages.push_front(&dataHolder);
+            dataHolder.unusedIt = unusedImages.begin();
+            unusedImageBytes += getImageByteCount(*dataHolder.data);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Increments the amount of users of the image, taking the image out of the unused images if it was cached
+        void addImageUser(TextureDataHolder& dataHolder)
+        {
+            if (dataHolder.users == 0)
+            {
+                unusedImageBytes -= getImageByteCount(*dataHolder.data);
+                unusedImages.erase(dataHolder.unusedIt);
+            }
+
+            ++dataHolder.users;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Removes the least recently used images that are no longer used until the unused images fit within the budget
+        void removeUnusedImages(ImageMap& imageMap, std::size_t budget, std::size_t& evictions)
+        {
+            while (!unusedImages.empty() && ((unusedImageBytes > budget) || (budget == 0)))
+            {
+                TextureDataHolder& dataHolder = *unusedImages.back();
+                unusedImageBytes -= getImageByteCount(*dataHolder.data);
+                unusedImages.pop_back();
+
+                // There are at most two holders per filename (with and without smoothing)
+                const auto imageIt = imageMap.find(dataHolder.filename);
+                TGUI_ASSERT(imageIt != imageMap.end(), "Unused image has to be part of the image map");
+                for (auto dataIt = imageIt->second.begin(); dataIt != imageIt->second.end(); ++dataIt)
+                {
+                    if (&*dataIt == &dataHolder)
+                    {
+                        eraseImage(imageMap, imageIt, dataIt);
+                        break;
+                    }
+                }
+
+                ++evictions;
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::map<String, std::list<TextureDataHolder>> TextureManager::m_imageMap;
+    bool TextureManager::m_atlasEnabled = false;
+    unsigned int TextureManager::m_atlasImageSizeLimit = 64;
+    std::size_t TextureManager::m_cacheBudget = 0;
+    bool TextureManager::m_downscalingEnabled = false;
+    TextureManager::Statistics TextureManager::m_statistics;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -55,7 +417,8 @@ namespace tgui
                 if (dataHolder.smooth == smooth)
                 {
                     // The exact same texture is now used at multiple places
-                    ++dataHolder.users;
+                    addImageUser(dataHolder);
+                    ++m_statistics.hits;
                     return dataHolder.data;
                 }
             }
@@ -67,6 +430,7 @@ namespace tgui
         }
 
         // Add new data to the list
+        ++m_statistics.misses;
         TGUI_EMPLACE_BACK(dataHolder, imageIt->second)
         dataHolder.filename = filename;
         dataHolder.users = 1;
@@ -81,7 +445,33 @@ namespace tgui
             if (data->svgImage->isSet())
                 return data;
         }
-        else // Not an svg
+        else if (m_atlasEnabled)
+        {
+            // Decode the image without creating a texture in the backend, so that a small image can be copied into the atlas.
+            // If the loader doesn't store the pixels then the image is loaded normally below.
+            BackendTexture image;
+            image.setPixelStorage(BackendTexture::PixelStorage::Full);
+            if (texture.getBackendTextureLoader()(image, filename, smooth) && image.getPixels())
+            {
+                const Vector2u imageSize = image.getSize();
+                if ((imageSize.x > 0) && (imageSize.y > 0) && (imageSize.x <= m_atlasImageSizeLimit) && (imageSize.y <= m_atlasImageSizeLimit)
+                 && addImageToAtlas(*data, image, smooth))
+                {
+                    return data;
+                }
+
+                // The image is too large for the atlas, it gets its own texture with the pixels that were already decoded
+                const std::size_t byteCount = 4 * static_cast<std::size_t>(imageSize.x) * imageSize.y;
+                auto pixels = MakeUniqueForOverwrite<std::uint8_t[]>(byteCount);
+                std::copy(image.getPixels(), image.getPixels() + byteCount, pixels.get());
+
+                data->backendTexture = getBackend()->createTexture();
+                if (data->backendTexture->load(imageSize, std::move(pixels), smooth))
+                    return data;
+            }
+        }
+
+        if (!isSvg && !data->backendTexture)
         {
             data->backendTexture = getBackend()->createTexture();
             if (texture.getBackendTextureLoader()(*data->backendTexture, filename, smooth))
@@ -99,6 +489,243 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::shared_ptr<TextureData> TextureManager::getTextureAsync(Texture& texture, const String& filename, bool smooth,
+                                                                 const std::function<void(bool success)>& onLoaded)
+    {
+        // Svg images aren't decoded when loading them, they are only rasterized when drawn
+        const bool isSvg = ((filename.length() > 4) && (viewEqualIgnoreCase(StringView(filename.c_str() + (filename.length() - 4), 4), U".svg")));
+        if (isSvg)
+            return getTexture(texture, filename, smooth);
+
+        texture.setCopyCallback(&TextureManager::copyTexture);
+        texture.setDestructCallback(&TextureManager::removeTexture);
+
+        // Look if we already had this image
+        auto imageIt = m_imageMap.find(filename);
+        if (imageIt != m_imageMap.end())
+        {
+            for (auto& dataHolder : imageIt->second)
+            {
+                if (dataHolder.smooth != smooth)
+                    continue;
+
+                addImageUser(dataHolder);
+                ++m_statistics.hits;
+
+                // If the image is still being decoded then the callback has to be called when it finishes
+                if (dataHolder.data->loading && onLoaded)
+                {
+                    for (auto& load : asyncTextureLoads)
+                    {
+                        if (load->data.lock() == dataHolder.data)
+                        {
+                            load->callbacks.push_back(onLoaded);
+                            break;
+                        }
+                    }
+                }
+
+                return dataHolder.data;
+            }
+        }
+
+        // Read the header of the file now, so that the texture already has the correct size before the image is decoded
+        ++m_statistics.misses;
+        Vector2u imageSize;
+        if (!ImageLoader::loadImageSizeFromFile(filename, imageSize))
+            return nullptr;
+
+        auto data = std::make_shared<TextureData>();
+        data->backendTexture = getBackend()->createTexture();
+        if (!data->backendTexture->loadTextureOnly(imageSize, nullptr, smooth))
+            return nullptr;
+
+        data->loading = true;
+
+        if (imageIt == m_imageMap.end())
+            imageIt = m_imageMap.insert({filename, {}}).first;
+
+        TGUI_EMPLACE_BACK(dataHolder, imageIt->second)
+        dataHolder.filename = filename;
+        dataHolder.users = 1;
+        dataHolder.smooth = smooth;
+        dataHolder.data = data;
+
+        auto load = std::make_shared<AsyncTextureLoad>();
+        load->filename = filename;
+        load->data = data;
+        load->smooth = smooth;
+        if (onLoaded)
+            load->callbacks.push_back(onLoaded);
+
+        asyncTextureLoads.push_back(load);
+        decodeImageAsync(asyncImageDecodeQueue, std::move(load));
+        return data;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::processAsyncLoads()
+    {
+        if (asyncTextureLoads.empty())
+            return false;
+
+        // The callbacks are only called at the end, as they might request new textures and thus modify the list of loads
+        std::vector<std::pair<std::vector<std::function<void(bool)>>, bool>> finishedCallbacks;
+
+        bool texturesLoaded = false;
+        auto loadIt = asyncTextureLoads.begin();
+        while (loadIt != asyncTextureLoads.end())
+        {
+            AsyncTextureLoad& load = **loadIt;
+            if (!load.decoded)
+            {
+                ++loadIt;
+                continue;
+            }
+
+            // If the texture is no longer used then there is nothing to upload
+            const std::shared_ptr<TextureData> data = load.data.lock();
+            if (!data)
+            {
+                loadIt = asyncTextureLoads.erase(loadIt);
+                continue;
+            }
+
+            const Vector2u textureSize = data->backendTexture->getSize();
+            const std::size_t byteCount = 4 * static_cast<std::size_t>(textureSize.x) * static_cast<std::size_t>(textureSize.y);
+            if (texturesLoaded && !BackendTexture::isWithinUploadBudget(byteCount))
+                break;
+
+            bool success = false;
+            if (load.pixels && (load.imageSize == textureSize))
+                success = data->backendTexture->load(textureSize, std::move(load.pixels), load.smooth);
+
+            // If decoding failed then the texture is made transparent, so that it won't show undefined contents
+            if (!success)
+            {
+                const auto transparentPixels = std::make_unique<std::uint8_t[]>(byteCount);
+                (void)data->backendTexture->loadTextureOnly(textureSize, transparentPixels.get(), load.smooth);
+            }
+
+            data->loading = false;
+            texturesLoaded = true;
+
+            if (!load.callbacks.empty())
+                finishedCallbacks.emplace_back(std::move(load.callbacks), success);
+
+            loadIt = asyncTextureLoads.erase(loadIt);
+        }
+
+        for (const auto& pair : finishedCallbacks)
+        {
+            for (const auto& callback : pair.first)
+                callback(pair.second);
+        }
+
+        return texturesLoaded;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getAsyncLoadCount()
+    {
+        return asyncTextureLoads.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAsyncUploadBudget(std::size_t bytesPerFrame)
+    {
+        BackendTexture::setUploadBudget(bytesPerFrame);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getAsyncUploadBudget()
+    {
+        return BackendTexture::getUploadBudget();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAtlasEnabled(bool enabled)
+    {
+        m_atlasEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::getAtlasEnabled()
+    {
+        return m_atlasEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAtlasImageSizeLimit(unsigned int maxSize)
+    {
+        m_atlasImageSizeLimit = maxSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int TextureManager::getAtlasImageSizeLimit()
+    {
+        return m_atlasImageSizeLimit;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getAtlasPageCount()
+    {
+        return textureAtlasPages.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setDownscalingEnabled(bool enabled)
+    {
+        m_downscalingEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::getDownscalingEnabled()
+    {
+        return m_downscalingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BackendTexture> TextureManager::getDownscaledTexture(TextureData& data, unsigned int factor)
+    {
+        if ((factor <= 1) || !data.backendTexture || data.loading || (data.atlasRect != UIntRect{}))
+            return nullptr;
+
+        const auto it = data.downscaledTextures.find(factor);
+        if (it != data.downscaledTextures.end())
+            return it->second;
+
+        const std::uint8_t* pixels = data.backendTexture->getPixels();
+        if (!pixels)
+            return nullptr;
+
+        const Vector2u size = data.backendTexture->getSize();
+        const Vector2u newSize{std::max(1u, size.x / factor), std::max(1u, size.y / factor)};
+        const auto newPixels = downscalePixels(pixels, size, newSize);
+
+        // Only the original texture needs to keep its pixels, it is the one that is used for isTransparentPixel
+        auto backendTexture = getBackend()->createTexture();
+        if (!backendTexture->loadTextureOnly(newSize, newPixels.get(), data.backendTexture->isSmooth()))
+            return nullptr;
+
+        data.downscaledTextures[factor] = backendTexture;
+        return backendTexture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextureManager::copyTexture(const std::shared_ptr<TextureData>& textureDataToCopy)
     {
         // Loop all our textures to check if we already have this one
@@ -110,7 +737,7 @@ namespace tgui
                 if (data.data == textureDataToCopy)
                 {
                     // The texture is now used at multiple places
-                    ++data.users;
+                    addImageUser(data);
                     return;
                 }
             }
@@ -131,12 +758,17 @@ namespace tgui
                 // Check if the pointer points to our texture
                 if (dataIt->data == textureDataToRemove)
                 {
-                    // If this was the only place where the texture is used then delete it
+                    // If this was the only place where the texture is used then delete it, unless it can remain cached
                     if (--(dataIt->users) == 0)
                     {
-                        imageIt->second.erase(dataIt);
-                        if (imageIt->second.empty())
-                            m_imageMap.erase(imageIt);
+                        // Svg images are never kept, their memory usage isn't part of the budget
+                        if ((m_cacheBudget > 0) && dataIt->data->backendTexture)
+                        {
+                            addUnusedImage(*dataIt);
+                            removeUnusedImages(m_imageMap, m_cacheBudget, m_statistics.evictions);
+                        }
+                        else
+                            eraseImage(m_imageMap, imageIt, dataIt);
                     }
 
                     return;
@@ -149,6 +781,57 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextureManager::setCacheBudget(std::size_t bytes)
+    {
+        m_cacheBudget = bytes;
+        removeUnusedImages(m_imageMap, m_cacheBudget, m_statistics.evictions);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getCacheBudget()
+    {
+        return m_cacheBudget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removeUnusedTextures()
+    {
+        removeUnusedImages(m_imageMap, 0, m_statistics.evictions);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextureManager::Statistics TextureManager::getStatistics()
+    {
+        Statistics statistics = m_statistics;
+        for (const auto& pair : m_imageMap)
+        {
+            for (const auto& dataHolder : pair.second)
+            {
+                const std::size_t byteCount = getImageByteCount(*dataHolder.data);
+                statistics.bytesResident += byteCount;
+                if (dataHolder.users == 0)
+                {
+                    statistics.bytesUnused += byteCount;
+                    ++statistics.unusedImages;
+                }
+            }
+        }
+
+        return statistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::resetStatistics()
+    {
+        m_statistics = {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::size_t TextureManager::getCachedImagesCount()
     {
         return m_imageMap.size();
@@ -25,10 +25,6 @@
 
 #include <TGUI/Timer.hpp>
 
-#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
-    #include <algorithm>
-#endif
-
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -56,6 +52,8 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::vector<std::shared_ptr<Timer>> Timer::m_activeTimers;
+    Duration Timer::m_currentTime;
+    std::uint64_t Timer::m_nextScheduleOrder = 0;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -106,21 +104,11 @@ namespace tgui
 
     void Timer::setEnabled(bool enabled)
     {
-        if (m_enabled != enabled)
-        {
-            if (enabled)
-                m_activeTimers.push_back(shared_from_this());
-            else
-            {
-                const auto it = std::find(m_activeTimers.begin(), m_activeTimers.end(), shared_from_this());
-                if (it != m_activeTimers.end())
-                    m_activeTimers.erase(it);
-            }
-        }
-
         m_enabled = enabled;
         if (enabled)
             restart();
+        else
+            unschedule(); // This may destroy the timer, so no members can be accessed afterwards
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -148,7 +136,8 @@ namespace tgui
 
     void Timer::restart()
     {
-        m_remainingDuration = m_interval;
+        if (m_enabled)
+            schedule(m_currentTime + m_interval);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -156,23 +145,43 @@ namespace tgui
     bool Timer::updateTime(Duration elapsedTime)
     {
         if (m_activeTimers.empty())
+        {
+            // The deadlines are relative to the current time, so we can start counting from 0 again when no timers are running
+            m_currentTime = {};
+            return false;
+        }
+
+        m_currentTime += elapsedTime;
+        if (m_activeTimers[0]->m_deadline > m_currentTime)
             return false;
 
+        // All timers that expire in this update are collected before calling any callback. A callback could start and stop
+        // timers, timers that are started from within a callback will only be triggered in a later update.
+        std::vector<std::shared_ptr<Timer>> expiredTimers;
+        while (!m_activeTimers.empty() && (m_activeTimers[0]->m_deadline <= m_currentTime))
+        {
+            expiredTimers.push_back(m_activeTimers[0]);
+            expiredTimers.back()->unschedule();
+        }
+
         bool timerTriggered = false;
-        auto activeTimers = m_activeTimers; // The callback could start and stop timers, so we need to operate on a copy
-        for (auto& timer : activeTimers)
+        for (auto& timer : expiredTimers)
         {
-            if (timer->m_remainingDuration > elapsedTime)
-                timer->m_remainingDuration -= elapsedTime;
+            // Skip the timer if it was stopped or restarted by a callback that was executed before it
+            if (!timer->m_enabled || (timer->m_heapIndex != NotScheduled))
+                continue;
+
+            timerTriggered = true;
+            timer->m_callback();
+
+            // The callback itself could also have stopped or restarted the timer
+            if (!timer->m_enabled || (timer->m_heapIndex != NotScheduled))
+                continue;
+
+            if (timer->m_repeats)
+                timer->schedule(m_currentTime + timer->m_interval);
             else
-            {
-                timerTriggered = true;
-                timer->m_callback();
-                timer->m_remainingDuration = timer->m_interval;
-
-                if (!timer->m_repeats)
-                    timer->setEnabled(false);
-            }
+                timer->m_enabled = false;
         }
 
         return timerTriggered;
@@ -186,22 +195,125 @@ namespace tgui
         if (m_activeTimers.empty())
             return {};
 
-        // Find the timer with the smallest remaining duration
-        Duration minDuration = m_activeTimers[0]->m_remainingDuration;
-        for (std::size_t i = 1; i < m_activeTimers.size(); ++i)
+        // The timer that has to be triggered first is always stored at the top of the heap
+        return m_activeTimers[0]->m_deadline - m_currentTime;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Timer::clearTimers()
+    {
+        for (auto& timer : m_activeTimers)
         {
-            if (m_activeTimers[i]->m_remainingDuration < minDuration)
-                minDuration = m_activeTimers[i]->m_remainingDuration;
+            timer->m_enabled = false;
+            timer->m_heapIndex = NotScheduled;
         }
 
-        return minDuration;
+        m_activeTimers.clear();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Timer::clearTimers()
+    void Timer::schedule(Duration deadline)
     {
-        m_activeTimers.clear();
+        m_deadline = deadline;
+        m_scheduleOrder = m_nextScheduleOrder++;
+
+        if (m_heapIndex == NotScheduled)
+        {
+            m_activeTimers.emplace_back();
+            placeInHeap(shared_from_this(), m_activeTimers.size() - 1);
+            moveUpInHeap(m_heapIndex);
+        }
+        else // The timer was already active, the deadline could have moved in either direction
+        {
+            moveUpInHeap(m_heapIndex);
+            moveDownInHeap(m_heapIndex);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Timer::unschedule()
+    {
+        if (m_heapIndex == NotScheduled)
+            return;
+
+        // Keep the timer alive until the end of this function, the active timers may contain the last reference to it
+        const std::size_t index = m_heapIndex;
+        const std::shared_ptr<Timer> self = std::move(m_activeTimers[index]);
+        m_heapIndex = NotScheduled;
+
+        // Move the last timer to the freed spot and then move it to the correct place in the heap
+        std::shared_ptr<Timer> lastTimer = std::move(m_activeTimers.back());
+        m_activeTimers.pop_back();
+        if (index < m_activeTimers.size())
+        {
+            Timer* const movedTimer = lastTimer.get();
+            placeInHeap(std::move(lastTimer), index);
+            moveUpInHeap(index);
+            moveDownInHeap(movedTimer->m_heapIndex);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Timer::isScheduledBefore(const Timer& left, const Timer& right)
+    {
+        if (left.m_deadline != right.m_deadline)
+            return left.m_deadline < right.m_deadline;
+        else
+            return left.m_scheduleOrder < right.m_scheduleOrder;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Timer::moveUpInHeap(std::size_t index)
+    {
+        std::shared_ptr<Timer> timer = std::move(m_activeTimers[index]);
+        while (index > 0)
+        {
+            const std::size_t parentIndex = (index - 1) / 2;
+            if (!isScheduledBefore(*timer, *m_activeTimers[parentIndex]))
+                break;
+
+            placeInHeap(std::move(m_activeTimers[parentIndex]), index);
+            index = parentIndex;
+        }
+
+        placeInHeap(std::move(timer), index);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Timer::moveDownInHeap(std::size_t index)
+    {
+        std::shared_ptr<Timer> timer = std::move(m_activeTimers[index]);
+        while (true)
+        {
+            std::size_t childIndex = (2 * index) + 1;
+            if (childIndex >= m_activeTimers.size())
+                break;
+
+            if ((childIndex + 1 < m_activeTimers.size()) && isScheduledBefore(*m_activeTimers[childIndex + 1], *m_activeTimers[childIndex]))
+                ++childIndex;
+
+            if (!isScheduledBefore(*m_activeTimers[childIndex], *timer))
+                break;
+
+            placeInHeap(std::move(m_activeTimers[childIndex]), index);
+            index = childIndex;
+        }
+
+        placeInHeap(std::move(timer), index);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Timer::placeInHeap(std::shared_ptr<Timer> timer, std::size_t index)
+    {
+        timer->m_heapIndex = index;
+        m_activeTimers[index] = std::move(timer);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -156,6 +156,9 @@ namespace tgui
             layout->unbindWidget();
 
         SignalManager::getSignalManager()->remove(this);
+
+        if (m_parentGui)
+            m_parentGui->removeActiveWidget(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -180,6 +183,7 @@ namespace tgui
         m_parentGui                    {nullptr},
         m_draggableWidget              {other.m_draggableWidget},
         m_containerWidget              {other.m_containerWidget},
+        m_hitAreaLimitedToSize         {other.m_hitAreaLimitedToSize},
         m_toolTip                      {other.m_toolTip ? other.m_toolTip->clone() : nullptr},
         m_renderer                     {other.m_renderer},
         m_showAnimations               {},
@@ -228,6 +232,7 @@ namespace tgui
         m_animationTimeElapsed         {std::move(other.m_animationTimeElapsed)},
         m_draggableWidget              {std::move(other.m_draggableWidget)},
         m_containerWidget              {std::move(other.m_containerWidget)},
+        m_hitAreaLimitedToSize         {std::move(other.m_hitAreaLimitedToSize)},
         m_toolTip                      {std::move(other.m_toolTip)},
         m_renderer                     {other.m_renderer},
         m_showAnimations               {std::move(other.m_showAnimations)},
@@ -269,6 +274,10 @@ namespace tgui
 
             m_showAnimations.clear();
 
+            // The widget is no longer part of the gui that it was in
+            if (m_parentGui)
+                m_parentGui->removeActiveWidget(this);
+
             m_type                 = other.m_type;
             m_name                 = other.m_name;
             m_position             = other.m_position;
@@ -291,6 +300,7 @@ namespace tgui
             m_animationTimeElapsed = {};
             m_draggableWidget      = other.m_draggableWidget;
             m_containerWidget      = other.m_containerWidget;
+            m_hitAreaLimitedToSize = other.m_hitAreaLimitedToSize;
             m_toolTip              = other.m_toolTip ? other.m_toolTip->clone() : nullptr;
             m_renderer             = other.m_renderer;
             m_fontCached           = other.m_fontCached;
@@ -318,6 +328,10 @@ namespace tgui
             m_renderer->unsubscribe(this);
             other.m_renderer->unsubscribe(&other);
 
+            // The widget is no longer part of the gui that it was in
+            if (m_parentGui)
+                m_parentGui->removeActiveWidget(this);
+
             onPositionChange       = std::move(other.onPositionChange);
             onSizeChange           = std::move(other.onSizeChange);
             onFocus                = std::move(other.onFocus);
@@ -346,6 +360,7 @@ namespace tgui
             m_animationTimeElapsed = std::move(other.m_animationTimeElapsed);
             m_draggableWidget      = std::move(other.m_draggableWidget);
             m_containerWidget      = std::move(other.m_containerWidget);
+            m_hitAreaLimitedToSize = std::move(other.m_hitAreaLimitedToSize);
             m_toolTip              = std::move(other.m_toolTip);
             m_renderer             = std::move(other.m_renderer);
             m_showAnimations       = std::move(other.m_showAnimations);
@@ -546,10 +561,17 @@ namespace tgui
             m_prevPosition = getPosition();
             onPositionChange.emit(this, getPosition());
 
+            if (m_parent)
+                m_parent->childWidgetBoundsChanged(this);
+
             // Update the connected layouts, but make a copy of the set before iterating over it to prevent issues
             // with the list being changed during the loop if some layout gets copied in a called setSize or setPosition function.
+            // A layout that was removed from the set during the loop may no longer exist and is skipped.
             for (auto* layout : std::unordered_set<Layout*>(m_boundPositionLayouts))
-                layout->recalculateValue();
+            {
+                if (m_boundPositionLayouts.find(layout) != m_boundPositionLayouts.end())
+                    layout->recalculateValue();
+            }
         }
     }
 
@@ -566,10 +588,17 @@ namespace tgui
             m_prevSize = getSize();
             onSizeChange.emit(this, getSize());
 
+            if (m_parent)
+                m_parent->childWidgetBoundsChanged(this);
+
             // Update the connected layouts, but make a copy of the set before iterating over it to prevent issues
             // with the list being changed during the loop if some layout gets copied in a called setSize or setPosition function.
+            // A layout that was removed from the set during the loop may no longer exist and is skipped.
             for (auto* layout : std::unordered_set<Layout*>(m_boundSizeLayouts))
-                layout->recalculateValue();
+            {
+                if (m_boundSizeLayouts.find(layout) != m_boundSizeLayouts.end())
+                    layout->recalculateValue();
+            }
 
             // If the origin isn't in the top left then changing the size also changes the position of the widget.
             // Note that getPosition() will still return the same value (hence we don't trigger onPositionChange), but if a
@@ -577,7 +606,10 @@ namespace tgui
             if ((m_origin.x != 0) || (m_origin.y != 0))
             {
                 for (auto* layout : std::unordered_set<Layout*>(m_boundPositionLayouts))
-                    layout->recalculateValue();
+                {
+                    if (m_boundPositionLayouts.find(layout) != m_boundPositionLayouts.end())
+                        layout->recalculateValue();
+                }
             }
         }
     }
@@ -628,6 +660,9 @@ namespace tgui
     void Widget::setOrigin(Vector2f origin)
     {
         m_origin = origin;
+
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -636,6 +671,9 @@ namespace tgui
     {
         m_scaleFactors = scaleFactors;
         m_scaleOrigin.reset();
+
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -644,6 +682,9 @@ namespace tgui
     {
         m_scaleFactors = scaleFactors;
         m_scaleOrigin = origin;
+
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -662,6 +703,9 @@ namespace tgui
     {
         m_rotationDeg = angle;
         m_rotationOrigin.reset();
+
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -670,6 +714,9 @@ namespace tgui
     {
         m_rotationDeg = angle;
         m_rotationOrigin = origin;
+
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -795,6 +842,8 @@ namespace tgui
                 break;
             }
         }
+
+        requestTimeUpdates();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -915,6 +964,8 @@ namespace tgui
                 break;
             }
         }
+
+        requestTimeUpdates();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -927,6 +978,8 @@ namespace tgui
         m_showAnimations.push_back(std::make_unique<priv::MoveAnimation>(shared_from_this(), getPosition(), position, duration,
             [this]{ onAnimationFinish.emit(this, AnimationType::Move); }
         ));
+
+        requestTimeUpdates();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -939,6 +992,8 @@ namespace tgui
         m_showAnimations.push_back(std::make_unique<priv::ResizeAnimation>(shared_from_this(), getSize(), size, duration,
             [this]{ onAnimationFinish.emit(this, AnimationType::Resize); }
         ));
+
+        requestTimeUpdates();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -993,6 +1048,7 @@ namespace tgui
             if (canGainFocus())
             {
                 m_focused = true;
+                requestTimeUpdates();
 
                 if (m_parent)
                     m_parent->childWidgetFocused(shared_from_this());
@@ -1108,9 +1164,11 @@ namespace tgui
     {
         if (m_name != name)
         {
+            const String oldName = m_name;
             m_name = name;
             if (m_parent)
             {
+                m_parent->childWidgetNameChanged(this, oldName);
                 SignalManager::getSignalManager()->remove(this);
                 SignalManager::getSignalManager()->add(shared_from_this());
             }
@@ -1197,7 +1255,16 @@ namespace tgui
 
     void Widget::setParent(Container* parent)
     {
+        BackendGui* const oldParentGui = m_parentGui;
         m_parentGui = parent ? parent->getParentGui() : nullptr;
+        if (m_parentGui != oldParentGui)
+        {
+            if (oldParentGui)
+                oldParentGui->removeActiveWidget(this);
+
+            requestTimeUpdates();
+        }
+
         if (m_parent == parent)
             return;
 
@@ -1247,6 +1314,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Widget::isUpdateTimeRequired() const
+    {
+        return !m_showAnimations.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Duration Widget::getTimeUntilNextUpdate() const
+    {
+        return {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::leftMousePressed(Vector2f)
     {
         m_mouseDown = true;
@@ -1405,37 +1486,52 @@ namespace tgui
 
     void Widget::rendererChanged(const String& property)
     {
-        if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            if (!m_enabled && (getSharedRenderer()->getOpacityDisabled() != -1))
-                m_opacityCached = getSharedRenderer()->getOpacityDisabled() * m_inheritedOpacity;
-            else
-                m_opacityCached = getSharedRenderer()->getOpacity() * m_inheritedOpacity;
-        }
-        else if (property == U"Font")
-        {
-            if (getSharedRenderer()->getFont())
-                m_fontCached = getSharedRenderer()->getFont();
-            else if (m_inheritedFont)
-                m_fontCached = m_inheritedFont;
-            else
-                m_fontCached = Font::getGlobalFont();
-        }
-        else if (property == U"TextSize")
-        {
-            if (getSharedRenderer()->getTextSize())
-                m_textSizeCached = getSharedRenderer()->getTextSize();
-            else
-                m_textSizeCached = m_textSize;
+        rendererPropertyChanged(WidgetRenderer::getPropertyId(property));
+    }
 
-            updateTextSize();
-        }
-        else if (property == U"TransparentTexture")
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::rendererPropertyChanged(RendererPropertyId property)
+    {
+        switch (property)
         {
-            m_transparentTextureCached = getSharedRenderer()->getTransparentTexture();
+            case RendererPropertyId::Opacity:
+            case RendererPropertyId::OpacityDisabled:
+            {
+                if (!m_enabled && (getSharedRenderer()->getOpacityDisabled() != -1))
+                    m_opacityCached = getSharedRenderer()->getOpacityDisabled() * m_inheritedOpacity;
+                else
+                    m_opacityCached = getSharedRenderer()->getOpacity() * m_inheritedOpacity;
+                break;
+            }
+            case RendererPropertyId::Font:
+            {
+                if (getSharedRenderer()->getFont())
+                    m_fontCached = getSharedRenderer()->getFont();
+                else if (m_inheritedFont)
+                    m_fontCached = m_inheritedFont;
+                else
+                    m_fontCached = Font::getGlobalFont();
+                break;
+            }
+            case RendererPropertyId::TextSize:
+            {
+                if (getSharedRenderer()->getTextSize())
+                    m_textSizeCached = getSharedRenderer()->getTextSize();
+                else
+                    m_textSizeCached = m_textSize;
+
+                updateTextSize();
+                break;
+            }
+            case RendererPropertyId::TransparentTexture:
+            {
+                m_transparentTextureCached = getSharedRenderer()->getTransparentTexture();
+                break;
+            }
+            default:
+                throw Exception{U"Could not set property '" + WidgetRenderer::getPropertyName(property) + U"', widget of type '" + getWidgetType() + U"' does not has this property."};
         }
-        else
-            throw Exception{U"Could not set property '" + property + U"', widget of type '" + getWidgetType() + U"' does not has this property."};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1716,6 +1812,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::requestTimeUpdates()
+    {
+        if (m_parentGui && isUpdateTimeRequired())
+            m_parentGui->addActiveWidget(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::rendererChangedCallback(const String& property)
     {
         rendererChanged(property);
@@ -176,15 +176,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void BitmapButton::rendererChanged(const String& property)
+    void BitmapButton::rendererPropertyChanged(RendererPropertyId property)
     {
-        if ((property == U"Opacity") || (property == U"OpacityDisabled"))
+        switch (property)
         {
-            Button::rendererChanged(property);
-            m_imageComponent->setOpacity(m_opacityCached);
+            case RendererPropertyId::Opacity:
+            case RendererPropertyId::OpacityDisabled:
+            {
+                Button::rendererPropertyChanged(property);
+                m_imageComponent->setOpacity(m_opacityCached);
+                break;
+            }
+            default:
+                Button::rendererPropertyChanged(property);
+                break;
         }
-        else
-            Button::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -86,6 +86,7 @@ namespace tgui
             m_widgets.pop_back();
 
             m_widgets.insert(m_widgets.begin() + static_cast<std::ptrdiff_t>(index), widget);
+            m_spatialIndexOrderNeedsUpdate = true;
         }
         else // Just add the widget to the back
             Group::add(widget, widgetName);
@@ -131,23 +132,29 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void BoxLayout::rendererChanged(const String& property)
+    void BoxLayout::rendererPropertyChanged(RendererPropertyId property)
     {
-        if (property == U"SpaceBetweenWidgets")
+        switch (property)
         {
-            m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
-            updateWidgets();
+            case RendererPropertyId::SpaceBetweenWidgets:
+            {
+                m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
+                updateWidgets();
+                break;
+            }
+            case RendererPropertyId::Padding:
+            {
+                Group::rendererPropertyChanged(property);
+
+                // Update the space between widgets as the padding is used when no space was explicitly set
+                m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
+                updateWidgets();
+                break;
+            }
+            default:
+                Group::rendererPropertyChanged(property);
+                break;
         }
-        else if (property == U"Padding")
-        {
-            Group::rendererChanged(property);
-
-            // Update the space between widgets as the padding is used when no space was explicitly set
-            m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
-            updateWidgets();
-        }
-        else
-            Group::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -322,121 +322,252 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ButtonBase::rendererChanged(const String& property)
+    void ButtonBase::rendererPropertyChanged(RendererPropertyId property)
     {
-        if (property == U"Borders")
+        switch (property)
         {
-            background.borders = getSharedRenderer()->getBorders();
-            updateSize();
+            case RendererPropertyId::Borders:
+            {
+                background.borders = getSharedRenderer()->getBorders();
+                updateSize();
+                break;
+            }
+            case RendererPropertyId::RoundedBorderRadius:
+            {
+                background.roundedBorderRadius = getSharedRenderer()->getRoundedBorderRadius();
+                break;
+            }
+            case RendererPropertyId::TextColor:
+            {
+                priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColor(), priv::dev::ComponentState::Normal);
+                break;
+            }
+            case RendererPropertyId::TextColorDown:
+            {
+                priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDown(), priv::dev::ComponentState::Active);
+                break;
+            }
+            case RendererPropertyId::TextColorHover:
+            {
+                priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorHover(), priv::dev::ComponentState::Hover);
+                break;
+            }
+            case RendererPropertyId::TextColorDownHover:
+            {
+                priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDownHover(), priv::dev::ComponentState::ActiveHover);
+                break;
+            }
+            case RendererPropertyId::TextColorDisabled:
+            {
+                priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDisabled(), priv::dev::ComponentState::Disabled);
+                break;
+            }
+            case RendererPropertyId::TextColorDownDisabled:
+            {
+                priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
+                break;
+            }
+            case RendererPropertyId::TextColorFocused:
+            {
+                priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorFocused(), priv::dev::ComponentState::Focused);
+                break;
+            }
+            case RendererPropertyId::TextColorDownFocused:
+            {
+                priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDownFocused(), priv::dev::ComponentState::FocusedActive);
+                break;
+            }
+            case RendererPropertyId::TextStyle:
+            {
+                priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyle(), priv::dev::ComponentState::Normal);
+                break;
+            }
+            case RendererPropertyId::TextStyleDown:
+            {
+                priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDown(), priv::dev::ComponentState::Active);
+                break;
+            }
+            case RendererPropertyId::TextStyleHover:
+            {
+                priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleHover(), priv::dev::ComponentState::Hover);
+                break;
+            }
+            case RendererPropertyId::TextStyleDownHover:
+            {
+                priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDownHover(), priv::dev::ComponentState::ActiveHover);
+                break;
+            }
+            case RendererPropertyId::TextStyleDisabled:
+            {
+                priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDisabled(), priv::dev::ComponentState::Disabled);
+                break;
+            }
+            case RendererPropertyId::TextStyleDownDisabled:
+            {
+                priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDownDisabled(), priv::dev::ComponentState::DisabledActive);
+                break;
+            }
+            case RendererPropertyId::TextStyleFocused:
+            {
+                priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleFocused(), priv::dev::ComponentState::Focused);
+                break;
+            }
+            case RendererPropertyId::TextStyleDownFocused:
+            {
+                priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDownFocused(), priv::dev::ComponentState::FocusedActive);
+                break;
+            }
+            case RendererPropertyId::Texture:
+            {
+                priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTexture(), priv::dev::ComponentState::Normal);
+                break;
+            }
+            case RendererPropertyId::TextureDown:
+            {
+                priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDown(), priv::dev::ComponentState::Active);
+                break;
+            }
+            case RendererPropertyId::TextureHover:
+            {
+                priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureHover(), priv::dev::ComponentState::Hover);
+                break;
+            }
+            case RendererPropertyId::TextureDownHover:
+            {
+                priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDownHover(), priv::dev::ComponentState::ActiveHover);
+                break;
+            }
+            case RendererPropertyId::TextureDisabled:
+            {
+                priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDisabled(), priv::dev::ComponentState::Disabled);
+                break;
+            }
+            case RendererPropertyId::TextureDownDisabled:
+            {
+                priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDownDisabled(), priv::dev::ComponentState::Disabled);
+                break;
+            }
+            case RendererPropertyId::TextureFocused:
+            {
+                priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureFocused(), priv::dev::ComponentState::Focused);
+                break;
+            }
+            case RendererPropertyId::TextureDownFocused:
+            {
+                priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDownFocused(), priv::dev::ComponentState::FocusedActive);
+                break;
+            }
+            case RendererPropertyId::BorderColor:
+            {
+                priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColor(), priv::dev::ComponentState::Normal);
+                break;
+            }
+            case RendererPropertyId::BorderColorDown:
+            {
+                priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDown(), priv::dev::ComponentState::Active);
+                break;
+            }
+            case RendererPropertyId::BorderColorHover:
+            {
+                priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorHover(), priv::dev::ComponentState::Hover);
+                break;
+            }
+            case RendererPropertyId::BorderColorDownHover:
+            {
+                priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDownHover(), priv::dev::ComponentState::ActiveHover);
+                break;
+            }
+            case RendererPropertyId::BorderColorDisabled:
+            {
+                priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDisabled(), priv::dev::ComponentState::Disabled);
+                break;
+            }
+            case RendererPropertyId::BorderColorDownDisabled:
+            {
+                priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
+                break;
+            }
+            case RendererPropertyId::BorderColorFocused:
+            {
+                priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorFocused(), priv::dev::ComponentState::Focused);
+                break;
+            }
+            case RendererPropertyId::BorderColorDownFocused:
+            {
+                priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDownFocused(), priv::dev::ComponentState::FocusedActive);
+                break;
+            }
+            case RendererPropertyId::BackgroundColor:
+            {
+                priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColor(), priv::dev::ComponentState::Normal);
+                break;
+            }
+            case RendererPropertyId::BackgroundColorDown:
+            {
+                priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDown(), priv::dev::ComponentState::Active);
+                break;
+            }
+            case RendererPropertyId::BackgroundColorHover:
+            {
+                priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorHover(), priv::dev::ComponentState::Hover);
+                break;
+            }
+            case RendererPropertyId::BackgroundColorDownHover:
+            {
+                priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDownHover(), priv::dev::ComponentState::ActiveHover);
+                break;
+            }
+            case RendererPropertyId::BackgroundColorDisabled:
+            {
+                priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDisabled(), priv::dev::ComponentState::Disabled);
+                break;
+            }
+            case RendererPropertyId::BackgroundColorDownDisabled:
+            {
+                priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
+                break;
+            }
+            case RendererPropertyId::BackgroundColorFocused:
+            {
+                priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorFocused(), priv::dev::ComponentState::Focused);
+                break;
+            }
+            case RendererPropertyId::BackgroundColorDownFocused:
+            {
+                priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDownFocused(), priv::dev::ComponentState::FocusedActive);
+                break;
+            }
+            case RendererPropertyId::TextOutlineThickness:
+            {
+                m_textComponent->setOutlineThickness(getSharedRenderer()->getTextOutlineThickness());
+                updateTextPosition();
+                break;
+            }
+            case RendererPropertyId::TextOutlineColor:
+            {
+                m_textComponent->setOutlineColor(getSharedRenderer()->getTextOutlineColor());
+                break;
+            }
+            case RendererPropertyId::Opacity:
+            case RendererPropertyId::OpacityDisabled:
+            {
+                ClickableWidget::rendererPropertyChanged(property);
+                m_textComponent->setOpacity(m_opacityCached);
+                m_backgroundComponent->setOpacity(m_opacityCached);
+                break;
+            }
+            case RendererPropertyId::Font:
+            {
+                ClickableWidget::rendererPropertyChanged(property);
+
+                m_textComponent->setFont(m_fontCached);
+                updateTextSize();
+                break;
+            }
+            default:
+                ClickableWidget::rendererPropertyChanged(property);
+                break;
         }
-        else if (property == U"RoundedBorderRadius")
-        {
-            background.roundedBorderRadius = getSharedRenderer()->getRoundedBorderRadius();
-        }
-        else if (property == U"TextColor")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColor(), priv::dev::ComponentState::Normal);
-        else if (property == U"TextColorDown")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDown(), priv::dev::ComponentState::Active);
-        else if (property == U"TextColorHover")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorHover(), priv::dev::ComponentState::Hover);
-        else if (property == U"TextColorDownHover")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDownHover(), priv::dev::ComponentState::ActiveHover);
-        else if (property == U"TextColorDisabled")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == U"TextColorDownDisabled")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
-        else if (property == U"TextColorFocused")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorFocused(), priv::dev::ComponentState::Focused);
-        else if (property == U"TextColorDownFocused")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDownFocused(), priv::dev::ComponentState::FocusedActive);
-        else if (property == U"TextStyle")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyle(), priv::dev::ComponentState::Normal);
-        else if (property == U"TextStyleDown")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDown(), priv::dev::ComponentState::Active);
-        else if (property == U"TextStyleHover")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleHover(), priv::dev::ComponentState::Hover);
-        else if (property == U"TextStyleDownHover")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDownHover(), priv::dev::ComponentState::ActiveHover);
-        else if (property == U"TextStyleDisabled")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == U"TextStyleDownDisabled")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDownDisabled(), priv::dev::ComponentState::DisabledActive);
-        else if (property == U"TextStyleFocused")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleFocused(), priv::dev::ComponentState::Focused);
-        else if (property == U"TextStyleDownFocused")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDownFocused(), priv::dev::ComponentState::FocusedActive);
-        else if (property == U"Texture")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTexture(), priv::dev::ComponentState::Normal);
-        else if (property == U"TextureDown")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDown(), priv::dev::ComponentState::Active);
-        else if (property == U"TextureHover")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureHover(), priv::dev::ComponentState::Hover);
-        else if (property == U"TextureDownHover")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDownHover(), priv::dev::ComponentState::ActiveHover);
-        else if (property == U"TextureDisabled")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == U"TextureDownDisabled")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDownDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == U"TextureFocused")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureFocused(), priv::dev::ComponentState::Focused);
-        else if (property == U"TextureDownFocused")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDownFocused(), priv::dev::ComponentState::FocusedActive);
-        else if (property == U"BorderColor")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColor(), priv::dev::ComponentState::Normal);
-        else if (property == U"BorderColorDown")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDown(), priv::dev::ComponentState::Active);
-        else if (property == U"BorderColorHover")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorHover(), priv::dev::ComponentState::Hover);
-        else if (property == U"BorderColorDownHover")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDownHover(), priv::dev::ComponentState::ActiveHover);
-        else if (property == U"BorderColorDisabled")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == U"BorderColorDownDisabled")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
-        else if (property == U"BorderColorFocused")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorFocused(), priv::dev::ComponentState::Focused);
-        else if (property == U"BorderColorDownFocused")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDownFocused(), priv::dev::ComponentState::FocusedActive);
-        else if (property == U"BackgroundColor")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColor(), priv::dev::ComponentState::Normal);
-        else if (property == U"BackgroundColorDown")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDown(), priv::dev::ComponentState::Active);
-        else if (property == U"BackgroundColorHover")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorHover(), priv::dev::ComponentState::Hover);
-        else if (property == U"BackgroundColorDownHover")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDownHover(), priv::dev::ComponentState::ActiveHover);
-        else if (property == U"BackgroundColorDisabled")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == U"BackgroundColorDownDisabled")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
-        else if (property == U"BackgroundColorFocused")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorFocused(), priv::dev::ComponentState::Focused);
-        else if (property == U"BackgroundColorDownFocused")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDownFocused(), priv::dev::ComponentState::FocusedActive);
-        else if (property == U"TextOutlineThickness")
-        {
-            m_textComponent->setOutlineThickness(getSharedRenderer()->getTextOutlineThickness());
-            updateTextPosition();
-        }
-        else if (property == U"TextOutlineColor")
-        {
-            m_textComponent->setOutlineColor(getSharedRenderer()->getTextOutlineColor());
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            ClickableWidget::rendererChanged(property);
-            m_textComponent->setOpacity(m_opacityCached);
-            m_backgroundComponent->setOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
-        {
-            ClickableWidget::rendererChanged(property);
-
-            m_textComponent->setFont(m_fontCached);
-            updateTextSize();
-        }
-        else
-            ClickableWidget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
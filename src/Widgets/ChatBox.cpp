@@ -25,6 +25,11 @@
 
 #include <TGUI/Widgets/ChatBox.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <cmath>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -148,12 +153,23 @@ namespace tgui
 
         recalculateLineText(line);
 
+        // The position of the new line follows from its neighbour, the other lines don't have to be touched
         if (m_newLinesBelowOthers)
+        {
+            if (!m_lines.empty())
+                line.top = m_lines.back().top + static_cast<double>(m_lines.back().text.getSize().y);
+
             m_lines.push_back(std::move(line));
+        }
         else
+        {
+            if (!m_lines.empty())
+                line.top = m_lines.front().top - static_cast<double>(line.text.getSize().y);
+
             m_lines.push_front(std::move(line));
+        }
 
-        recalculateFullTextHeight();
+        updateFullTextHeight();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -196,9 +212,17 @@ namespace tgui
     {
         if (lineIndex < m_lines.size())
         {
+            const float lineHeight = m_lines[lineIndex].text.getSize().y;
             m_lines.erase(m_lines.begin() + static_cast<std::ptrdiff_t>(lineIndex));
 
-            recalculateFullTextHeight();
+            // Move the lines below the removed line up. Positions are relative to the first line, so nothing changes when it was removed.
+            if (lineIndex > 0)
+            {
+                for (std::size_t i = lineIndex; i < m_lines.size(); ++i)
+                    m_lines[i].top -= static_cast<double>(lineHeight);
+            }
+
+            updateFullTextHeight();
             return true;
         }
         else // Index too high
@@ -211,7 +235,29 @@ namespace tgui
     {
         m_lines.clear();
 
-        recalculateFullTextHeight();
+        updateFullTextHeight();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::beginUpdate()
+    {
+        ++m_updateBatchDepth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::endUpdate()
+    {
+        if (m_updateBatchDepth == 0)
+            return;
+
+        --m_updateBatchDepth;
+        if ((m_updateBatchDepth == 0) && m_fullTextHeightNeedsUpdate)
+        {
+            m_fullTextHeightNeedsUpdate = false;
+            updateFullTextHeight();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -235,7 +281,7 @@ namespace tgui
             else
                 m_lines.erase(m_lines.begin() + static_cast<std::ptrdiff_t>(m_maxLines), m_lines.end());
 
-            recalculateFullTextHeight();
+            updateFullTextHeight();
         }
     }
 
@@ -428,9 +474,41 @@ namespace tgui
 
     void ChatBox::recalculateFullTextHeight()
     {
-        m_fullTextHeight = 0;
-        for (const auto& line : m_lines)
-            m_fullTextHeight += line.text.getSize().y;
+        double top = 0;
+        for (auto& line : m_lines)
+        {
+            line.top = top;
+            top += static_cast<double>(line.text.getSize().y);
+        }
+
+        updateFullTextHeight();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::updateFullTextHeight()
+    {
+        // Postpone the update until the batch of changes has ended
+        if (m_updateBatchDepth > 0)
+        {
+            m_fullTextHeightNeedsUpdate = true;
+            return;
+        }
+
+        if (!m_lines.empty())
+        {
+            // The origin moves each time a line is removed from the front. The positions are stored as doubles, so they remain
+            // exact for a very long time, but they are still recalculated to start from 0 before the precision would get lost.
+            if (std::abs(m_lines.front().top) > 1e12)
+            {
+                recalculateFullTextHeight();
+                return;
+            }
+
+            m_fullTextHeight = static_cast<float>(m_lines.back().top + static_cast<double>(m_lines.back().text.getSize().y) - m_lines.front().top);
+        }
+        else
+            m_fullTextHeight = 0;
 
         // Update the maximum of the scrollbar
         const unsigned int oldMaximum = m_scroll->getMaximum();
@@ -449,68 +527,82 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ChatBox::rendererChanged(const String& property)
+    void ChatBox::rendererPropertyChanged(RendererPropertyId property)
     {
-        if (property == U"Borders")
+        switch (property)
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == U"Padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == U"TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == U"Scrollbar")
-        {
-            m_scroll->setRenderer(getSharedRenderer()->getScrollbar());
-
-            // If no scrollbar width was set then we may need to use the one from the texture
-            if (getSharedRenderer()->getScrollbarWidth() == 0)
+            case RendererPropertyId::Borders:
             {
-                m_scroll->setSize({m_scroll->getDefaultWidth(), m_scroll->getSize().y});
+                m_bordersCached = getSharedRenderer()->getBorders();
                 setSize(m_size);
+                break;
             }
-        }
-        else if (property == U"ScrollbarWidth")
-        {
-            const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_scroll->getDefaultWidth();
-            m_scroll->setSize({width, m_scroll->getSize().y});
-            setSize(m_size);
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
+            case RendererPropertyId::Padding:
+            {
+                m_paddingCached = getSharedRenderer()->getPadding();
+                setSize(m_size);
+                break;
+            }
+            case RendererPropertyId::TextureBackground:
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+            }
+            case RendererPropertyId::Scrollbar:
+            {
+                m_scroll->setRenderer(getSharedRenderer()->getScrollbar());
+
+                // If no scrollbar width was set then we may need to use the one from the texture
+                if (getSharedRenderer()->getScrollbarWidth() == 0)
+                {
+                    m_scroll->setSize({m_scroll->getDefaultWidth(), m_scroll->getSize().y});
+                    setSize(m_size);
+                }
+                break;
+            }
+            case RendererPropertyId::ScrollbarWidth:
+            {
+                const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_scroll->getDefaultWidth();
+                m_scroll->setSize({width, m_scroll->getSize().y});
+                setSize(m_size);
+                break;
+            }
+            case RendererPropertyId::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+            case RendererPropertyId::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+            case RendererPropertyId::Opacity:
+            case RendererPropertyId::OpacityDisabled:
+            {
+                Widget::rendererPropertyChanged(property);
 
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_scroll->setInheritedOpacity(m_opacityCached);
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_scroll->setInheritedOpacity(m_opacityCached);
 
-            for (auto& line : m_lines)
-                line.text.setOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
-        {
-            Widget::rendererChanged(property);
+                for (auto& line : m_lines)
+                    line.text.setOpacity(m_opacityCached);
+                break;
+            }
+            case RendererPropertyId::Font:
+            {
+                Widget::rendererPropertyChanged(property);
 
-            for (auto& line : m_lines)
-                line.text.setFont(m_fontCached);
+                for (auto& line : m_lines)
+                    line.text.setFont(m_fontCached);
 
-            recalculateAllLines();
+                recalculateAllLines();
+                break;
+            }
+            default:
+                Widget::rendererPropertyChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -632,16 +724,29 @@ namespace tgui
         target.addClippingLayer(states, {{}, {getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - m_scroll->getSize().x,
                                               getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()}});
 
-        states.transform.translate({Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached), -static_cast<float>(m_scroll->getValue())});
+        const float visibleHeight = getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom();
+        float offsetY = -static_cast<float>(m_scroll->getValue());
 
         // Put the lines at the bottom of the chat box if needed
-        if (!m_linesStartFromTop && (m_fullTextHeight + Text::getExtraVerticalPadding(m_textSizeCached) < getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()))
-            states.transform.translate({0, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - m_fullTextHeight - Text::getExtraVerticalPadding(m_textSizeCached)});
+        if (!m_linesStartFromTop && (m_fullTextHeight + Text::getExtraVerticalPadding(m_textSizeCached) < visibleHeight))
+            offsetY += visibleHeight - m_fullTextHeight - Text::getExtraVerticalPadding(m_textSizeCached);
+
+        states.transform.translate({Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached), offsetY});
 
-        for (const auto& line : m_lines)
+        if (!m_lines.empty())
         {
-            target.drawText(states, line.text);
-            states.transform.translate({0, line.text.getSize().y});
+            // Only draw the lines that are inside the visible area. The first one is found with a binary search on the line positions.
+            const double origin = m_lines.front().top;
+            const double visibleTop = origin - static_cast<double>(offsetY);
+            auto it = std::partition_point(m_lines.begin(), m_lines.end(),
+                [visibleTop](const Line& line){ return line.top + static_cast<double>(line.text.getSize().y) <= visibleTop; });
+
+            for (; (it != m_lines.end()) && (it->top < visibleTop + static_cast<double>(visibleHeight)); ++it)
+            {
+                RenderStates lineStates = states;
+                lineStates.transform.translate({0, static_cast<float>(it->top - origin)});
+                target.drawText(lineStates, it->text);
+            }
         }
 
         target.removeClippingLayer();
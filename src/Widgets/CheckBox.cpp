@@ -186,14 +186,25 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void CheckBox::rendererChanged(const String& property)
+    void CheckBox::rendererPropertyChanged(RendererPropertyId property)
     {
-        if (property == U"TextureUnchecked")
-            m_textureUncheckedCached = getSharedRenderer()->getTextureUnchecked();
-        else if (property == U"TextureChecked")
-            m_textureCheckedCached = getSharedRenderer()->getTextureChecked();
+        switch (property)
+        {
+            case RendererPropertyId::TextureUnchecked:
+            {
+                m_textureUncheckedCached = getSharedRenderer()->getTextureUnchecked();
+                break;
+            }
+            case RendererPropertyId::TextureChecked:
+            {
+                m_textureCheckedCached = getSharedRenderer()->getTextureChecked();
+                break;
+            }
+            default:
+                break;
+        }
 
-        RadioButton::rendererChanged(property);
+        RadioButton::rendererPropertyChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
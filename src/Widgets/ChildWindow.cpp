@@ -61,6 +61,7 @@ namespace tgui
         Container{typeName, false}
     {
         m_isolatedFocus = true;
+        m_hitAreaLimitedToSize = false;
         m_titleText.setFont(m_fontCached);
 
         setTitleTextSize(getGlobalTextSize());
@@ -1063,158 +1064,182 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ChildWindow::rendererChanged(const String& property)
+    void ChildWindow::rendererPropertyChanged(RendererPropertyId property)
     {
-        if (property == U"Borders")
+        switch (property)
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
+            case RendererPropertyId::Borders:
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
 
-            if (m_decorationLayoutX && (m_decorationLayoutX == m_size.x.getRightOperand()))
-                m_decorationLayoutX->replaceValue(m_bordersCached.getLeft() + m_bordersCached.getRight());
-            if (m_decorationLayoutY && (m_decorationLayoutY == m_size.y.getRightOperand()))
-                m_decorationLayoutY->replaceValue(m_bordersCached.getTop() + m_bordersCached.getBottom() + m_titleBarHeightCached + m_borderBelowTitleBarCached);
+                if (m_decorationLayoutX && (m_decorationLayoutX == m_size.x.getRightOperand()))
+                    m_decorationLayoutX->replaceValue(m_bordersCached.getLeft() + m_bordersCached.getRight());
+                if (m_decorationLayoutY && (m_decorationLayoutY == m_size.y.getRightOperand()))
+                    m_decorationLayoutY->replaceValue(m_bordersCached.getTop() + m_bordersCached.getBottom() + m_titleBarHeightCached + m_borderBelowTitleBarCached);
 
-            setSize(m_size);
-        }
-        else if (property == U"TitleColor")
-        {
-            m_titleText.setColor(getSharedRenderer()->getTitleColor());
-        }
-        else if ((property == U"TextureTitleBar") || (property == U"TitleBarHeight"))
-        {
-            const float oldTitleBarHeight = m_titleBarHeightCached;
+                setSize(m_size);
+                break;
+            }
+            case RendererPropertyId::TitleColor:
+            {
+                m_titleText.setColor(getSharedRenderer()->getTitleColor());
+                break;
+            }
+            case RendererPropertyId::TextureTitleBar:
+            case RendererPropertyId::TitleBarHeight:
+            {
+                const float oldTitleBarHeight = m_titleBarHeightCached;
 
-            if (property == U"TextureTitleBar")
-                m_spriteTitleBar.setTexture(getSharedRenderer()->getTextureTitleBar());
+                if (property == RendererPropertyId::TextureTitleBar)
+                    m_spriteTitleBar.setTexture(getSharedRenderer()->getTextureTitleBar());
 
-            m_titleBarHeightCached = getSharedRenderer()->getTitleBarHeight();
-            updateTitleBarHeight();
+                m_titleBarHeightCached = getSharedRenderer()->getTitleBarHeight();
+                updateTitleBarHeight();
 
-            if (oldTitleBarHeight != m_titleBarHeightCached)
+                if (oldTitleBarHeight != m_titleBarHeightCached)
+                {
+                    if (m_decorationLayoutY && (m_decorationLayoutY == m_size.y.getRightOperand()))
+                        m_decorationLayoutY->replaceValue(m_bordersCached.getTop() + m_bordersCached.getBottom() + m_titleBarHeightCached + m_borderBelowTitleBarCached);
+
+                    // If the title bar changes in height then the inner size will also change
+                    for (auto& layout : m_boundSizeLayouts)
+                        layout->recalculateValue();
+                }
+                break;
+            }
+            case RendererPropertyId::TextureBackground:
             {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+            }
+            case RendererPropertyId::BorderBelowTitleBar:
+            {
+                m_borderBelowTitleBarCached = getSharedRenderer()->getBorderBelowTitleBar();
                 if (m_decorationLayoutY && (m_decorationLayoutY == m_size.y.getRightOperand()))
                     m_decorationLayoutY->replaceValue(m_bordersCached.getTop() + m_bordersCached.getBottom() + m_titleBarHeightCached + m_borderBelowTitleBarCached);
-
-                // If the title bar changes in height then the inner size will also change
-                for (auto& layout : m_boundSizeLayouts)
-                    layout->recalculateValue();
+                break;
             }
-        }
-        else if (property == U"TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == U"BorderBelowTitleBar")
-        {
-            m_borderBelowTitleBarCached = getSharedRenderer()->getBorderBelowTitleBar();
-            if (m_decorationLayoutY && (m_decorationLayoutY == m_size.y.getRightOperand()))
-                m_decorationLayoutY->replaceValue(m_bordersCached.getTop() + m_bordersCached.getBottom() + m_titleBarHeightCached + m_borderBelowTitleBarCached);
-        }
-        else if (property == U"DistanceToSide")
-        {
-            m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
-            setPosition(m_position);
-        }
-        else if (property == U"PaddingBetweenButtons")
-        {
-            m_paddingBetweenButtonsCached = getSharedRenderer()->getPaddingBetweenButtons();
-            setPosition(m_position);
-        }
-        else if (property == U"MinimumResizableBorderWidth")
-        {
-            m_minimumResizableBorderWidthCached = getSharedRenderer()->getMinimumResizableBorderWidth();
-        }
-        else if (property == U"ShowTextOnTitleButtons")
-        {
-            m_showTextOnTitleButtonsCached = getSharedRenderer()->getShowTextOnTitleButtons();
-            setTitleButtons(m_titleButtons);
-        }
-        else if (property == U"CloseButton")
-        {
-            if (m_closeButton->isVisible())
+            case RendererPropertyId::DistanceToSide:
             {
-                m_closeButton->setRenderer(getSharedRenderer()->getCloseButton());
-                m_closeButton->setInheritedOpacity(m_opacityCached);
+                m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
+                setPosition(m_position);
+                break;
             }
-
-            updateTitleBarHeight();
-        }
-        else if (property == U"MaximizeButton")
-        {
-            if (m_maximizeButton->isVisible())
+            case RendererPropertyId::PaddingBetweenButtons:
             {
-                auto buttonRenderer = getSharedRenderer()->getMaximizeButton();
-                if (!buttonRenderer || (buttonRenderer->propertyValuePairs.empty() && !buttonRenderer->connectedTheme))
-                    buttonRenderer = getSharedRenderer()->getCloseButton();
-
-                m_maximizeButton->setRenderer(buttonRenderer);
-                m_maximizeButton->setInheritedOpacity(m_opacityCached);
+                m_paddingBetweenButtonsCached = getSharedRenderer()->getPaddingBetweenButtons();
+                setPosition(m_position);
+                break;
+            }
+            case RendererPropertyId::MinimumResizableBorderWidth:
+            {
+                m_minimumResizableBorderWidthCached = getSharedRenderer()->getMinimumResizableBorderWidth();
+                break;
             }
+            case RendererPropertyId::ShowTextOnTitleButtons:
+            {
+                m_showTextOnTitleButtonsCached = getSharedRenderer()->getShowTextOnTitleButtons();
+                setTitleButtons(m_titleButtons);
+                break;
+            }
+            case RendererPropertyId::CloseButton:
+            {
+                if (m_closeButton->isVisible())
+                {
+                    m_closeButton->setRenderer(getSharedRenderer()->getCloseButton());
+                    m_closeButton->setInheritedOpacity(m_opacityCached);
+                }
 
-            updateTitleBarHeight();
-        }
-        else if (property == U"MinimizeButton")
-        {
-            if (m_minimizeButton->isVisible())
+                updateTitleBarHeight();
+                break;
+            }
+            case RendererPropertyId::MaximizeButton:
             {
-                auto buttonRenderer = getSharedRenderer()->getMinimizeButton();
-                if (!buttonRenderer || (buttonRenderer->propertyValuePairs.empty() && !buttonRenderer->connectedTheme))
-                    buttonRenderer = getSharedRenderer()->getCloseButton();
+                if (m_maximizeButton->isVisible())
+                {
+                    auto buttonRenderer = getSharedRenderer()->getMaximizeButton();
+                    if (!buttonRenderer || (buttonRenderer->propertyValuePairs.empty() && !buttonRenderer->connectedTheme))
+                        buttonRenderer = getSharedRenderer()->getCloseButton();
+
+                    m_maximizeButton->setRenderer(buttonRenderer);
+                    m_maximizeButton->setInheritedOpacity(m_opacityCached);
+                }
 
-                m_minimizeButton->setRenderer(buttonRenderer);
-                m_minimizeButton->setInheritedOpacity(m_opacityCached);
+                updateTitleBarHeight();
+                break;
             }
+            case RendererPropertyId::MinimizeButton:
+            {
+                if (m_minimizeButton->isVisible())
+                {
+                    auto buttonRenderer = getSharedRenderer()->getMinimizeButton();
+                    if (!buttonRenderer || (buttonRenderer->propertyValuePairs.empty() && !buttonRenderer->connectedTheme))
+                        buttonRenderer = getSharedRenderer()->getCloseButton();
 
-            updateTitleBarHeight();
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"TitleBarColor")
-        {
-            m_titleBarColorCached = getSharedRenderer()->getTitleBarColor();
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"BorderColorFocused")
-        {
-            m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Container::rendererChanged(property);
+                    m_minimizeButton->setRenderer(buttonRenderer);
+                    m_minimizeButton->setInheritedOpacity(m_opacityCached);
+                }
 
-            for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
+                updateTitleBarHeight();
+                break;
+            }
+            case RendererPropertyId::BackgroundColor:
             {
-                if (button->isVisible())
-                    button->setInheritedOpacity(m_opacityCached);
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
             }
+            case RendererPropertyId::TitleBarColor:
+            {
+                m_titleBarColorCached = getSharedRenderer()->getTitleBarColor();
+                break;
+            }
+            case RendererPropertyId::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+            case RendererPropertyId::BorderColorFocused:
+            {
+                m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
+                break;
+            }
+            case RendererPropertyId::Opacity:
+            case RendererPropertyId::OpacityDisabled:
+            {
+                Container::rendererPropertyChanged(property);
 
-            m_titleText.setOpacity(m_opacityCached);
-            m_spriteTitleBar.setOpacity(m_opacityCached);
-            m_spriteBackground.setOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
-        {
-            Container::rendererChanged(property);
+                for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
+                {
+                    if (button->isVisible())
+                        button->setInheritedOpacity(m_opacityCached);
+                }
 
-            for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
-            {
-                if (button->isVisible())
-                    button->setInheritedFont(m_fontCached);
+                m_titleText.setOpacity(m_opacityCached);
+                m_spriteTitleBar.setOpacity(m_opacityCached);
+                m_spriteBackground.setOpacity(m_opacityCached);
+                break;
             }
+            case RendererPropertyId::Font:
+            {
+                Container::rendererPropertyChanged(property);
 
-            m_titleText.setFont(m_fontCached);
-            if (m_titleTextSize == 0)
-                m_titleText.setCharacterSize(Text::findBestTextSize(m_fontCached, getSharedRenderer()->getTitleBarHeight() * 0.8f));
+                for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
+                {
+                    if (button->isVisible())
+                        button->setInheritedFont(m_fontCached);
+                }
 
-            setPosition(m_position);
+                m_titleText.setFont(m_fontCached);
+                if (m_titleTextSize == 0)
+                    m_titleText.setCharacterSize(Text::findBestTextSize(m_fontCached, getSharedRenderer()->getTitleBarHeight() * 0.8f));
+
+                setPosition(m_position);
+                break;
+            }
+            default:
+                Container::rendererPropertyChanged(property);
+                break;
         }
-        else
-            Container::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -536,50 +536,59 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ColorPicker::rendererChanged(const String& property)
+    void ColorPicker::rendererPropertyChanged(RendererPropertyId property)
     {
-        if (property == U"Button")
+        switch (property)
         {
-            const auto& renderer = getSharedRenderer()->getButton();
-
-            // During loading from file, the renderer is loaded before the child widgets are loaded.
-            // In this exceptional case, we shouldn't try to set the renderer. The buttons will have their renderer in the form file anyway.
-            if (get("#TGUI_INTERNAL$ColorPickerOK#"))
+            case RendererPropertyId::Button:
             {
-                get<Button>("#TGUI_INTERNAL$ColorPickerReset#")->setRenderer(renderer);
-                get<Button>("#TGUI_INTERNAL$ColorPickerOK#")->setRenderer(renderer);
-                get<Button>("#TGUI_INTERNAL$ColorPickerCancel#")->setRenderer(renderer);
-            }
-        }
-        else if (property == U"Label")
-        {
-            const auto& renderer = getSharedRenderer()->getLabel();
+                const auto& renderer = getSharedRenderer()->getButton();
 
-            for (const auto& it : getWidgets())
+                // During loading from file, the renderer is loaded before the child widgets are loaded.
+                // In this exceptional case, we shouldn't try to set the renderer. The buttons will have their renderer in the form file anyway.
+                if (get("#TGUI_INTERNAL$ColorPickerOK#"))
+                {
+                    get<Button>("#TGUI_INTERNAL$ColorPickerReset#")->setRenderer(renderer);
+                    get<Button>("#TGUI_INTERNAL$ColorPickerOK#")->setRenderer(renderer);
+                    get<Button>("#TGUI_INTERNAL$ColorPickerCancel#")->setRenderer(renderer);
+                }
+                break;
+            }
+            case RendererPropertyId::Label:
             {
-                auto label = std::dynamic_pointer_cast<Label>(it);
-                if (label)
-                    label->setRenderer(renderer);
+                const auto& renderer = getSharedRenderer()->getLabel();
+
+                for (const auto& it : getWidgets())
+                {
+                    auto label = std::dynamic_pointer_cast<Label>(it);
+                    if (label)
+                        label->setRenderer(renderer);
+                }
+                break;
             }
-        }
-        else if (property == U"Slider")
-        {
-            const auto& renderer = getSharedRenderer()->getSlider();
+            case RendererPropertyId::Slider:
+            {
+                const auto& renderer = getSharedRenderer()->getSlider();
 
-            m_red->setRenderer(renderer);
-            m_green->setRenderer(renderer);
-            m_blue->setRenderer(renderer);
-            m_alpha->setRenderer(renderer);
+                m_red->setRenderer(renderer);
+                m_green->setRenderer(renderer);
+                m_blue->setRenderer(renderer);
+                m_alpha->setRenderer(renderer);
 
-            m_value->setRenderer(renderer);
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            ChildWindow::rendererChanged(property);
-            m_colorWheelSprite.setOpacity(m_opacityCached);
+                m_value->setRenderer(renderer);
+                break;
+            }
+            case RendererPropertyId::Opacity:
+            case RendererPropertyId::OpacityDisabled:
+            {
+                ChildWindow::rendererPropertyChanged(property);
+                m_colorWheelSprite.setOpacity(m_opacityCached);
+                break;
+            }
+            default:
+                ChildWindow::rendererPropertyChanged(property);
+                break;
         }
-        else
-            ChildWindow::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
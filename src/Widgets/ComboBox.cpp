@@ -644,138 +644,167 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ComboBox::rendererChanged(const String& property)
+    void ComboBox::rendererPropertyChanged(RendererPropertyId property)
     {
-        if (property == U"Borders")
+        switch (property)
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == U"Padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == U"TextColor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            if (m_enabled || !m_textColorDisabledCached.isSet())
-                m_text.setColor(m_textColorCached);
-            if (!getSharedRenderer()->getDefaultTextColor().isSet())
-                m_defaultText.setColor(getSharedRenderer()->getTextColor());
-        }
-        else if (property == U"TextColorDisabled")
-        {
-            m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
-            if (!m_enabled && m_textColorDisabledCached.isSet())
-                m_text.setColor(m_textColorDisabledCached);
-        }
-        else if (property == U"TextStyle")
-        {
-            m_text.setStyle(getSharedRenderer()->getTextStyle());
-            if (!getSharedRenderer()->getDefaultTextStyle().isSet())
-                m_defaultText.setStyle(getSharedRenderer()->getTextStyle());
-        }
-        else if (property == U"DefaultTextColor")
-        {
-            if (getSharedRenderer()->getDefaultTextColor().isSet())
-                m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
-            else
-                m_defaultText.setColor(getSharedRenderer()->getTextColor());
-        }
-        else if (property == U"DefaultTextStyle")
-        {
-            if (getSharedRenderer()->getDefaultTextStyle().isSet())
-                m_defaultText.setStyle(getSharedRenderer()->getDefaultTextStyle());
-            else
-                m_defaultText.setStyle(getSharedRenderer()->getTextStyle());
-        }
-        else if (property == U"TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == U"TextureBackgroundDisabled")
-        {
-            m_spriteBackgroundDisabled.setTexture(getSharedRenderer()->getTextureBackgroundDisabled());
-        }
-        else if (property == U"TextureArrow")
-        {
-            m_spriteArrow.setTexture(getSharedRenderer()->getTextureArrow());
-            setSize(m_size);
-        }
-        else if (property == U"TextureArrowHover")
-        {
-            m_spriteArrowHover.setTexture(getSharedRenderer()->getTextureArrowHover());
-        }
-        else if (property == U"TextureArrowDisabled")
-        {
-            m_spriteArrowDisabled.setTexture(getSharedRenderer()->getTextureArrowDisabled());
-        }
-        else if (property == U"ListBox")
-        {
-            m_listBox->setRenderer(getSharedRenderer()->getListBox());
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"BackgroundColorDisabled")
-        {
-            m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
-        }
-        else if (property == U"ArrowBackgroundColor")
-        {
-            m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
-        }
-        else if (property == U"ArrowBackgroundColorHover")
-        {
-            m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
-        }
-        else if (property == U"ArrowBackgroundColorDisabled")
-        {
-            m_arrowBackgroundColorDisabledCached = getSharedRenderer()->getArrowBackgroundColorDisabled();
-        }
-        else if (property == U"ArrowColor")
-        {
-            m_arrowColorCached = getSharedRenderer()->getArrowColor();
-        }
-        else if (property == U"ArrowColorHover")
-        {
-            m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
-        }
-        else if (property == U"ArrowColorDisabled")
-        {
-            m_arrowColorDisabledCached = getSharedRenderer()->getArrowColorDisabled();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
+            case RendererPropertyId::Borders:
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
+            }
+            case RendererPropertyId::Padding:
+            {
+                m_paddingCached = getSharedRenderer()->getPadding();
+                setSize(m_size);
+                break;
+            }
+            case RendererPropertyId::TextColor:
+            {
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                if (m_enabled || !m_textColorDisabledCached.isSet())
+                    m_text.setColor(m_textColorCached);
+                if (!getSharedRenderer()->getDefaultTextColor().isSet())
+                    m_defaultText.setColor(getSharedRenderer()->getTextColor());
+                break;
+            }
+            case RendererPropertyId::TextColorDisabled:
+            {
+                m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
+                if (!m_enabled && m_textColorDisabledCached.isSet())
+                    m_text.setColor(m_textColorDisabledCached);
+                break;
+            }
+            case RendererPropertyId::TextStyle:
+            {
+                m_text.setStyle(getSharedRenderer()->getTextStyle());
+                if (!getSharedRenderer()->getDefaultTextStyle().isSet())
+                    m_defaultText.setStyle(getSharedRenderer()->getTextStyle());
+                break;
+            }
+            case RendererPropertyId::DefaultTextColor:
+            {
+                if (getSharedRenderer()->getDefaultTextColor().isSet())
+                    m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
+                else
+                    m_defaultText.setColor(getSharedRenderer()->getTextColor());
+                break;
+            }
+            case RendererPropertyId::DefaultTextStyle:
+            {
+                if (getSharedRenderer()->getDefaultTextStyle().isSet())
+                    m_defaultText.setStyle(getSharedRenderer()->getDefaultTextStyle());
+                else
+                    m_defaultText.setStyle(getSharedRenderer()->getTextStyle());
+                break;
+            }
+            case RendererPropertyId::TextureBackground:
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+            }
+            case RendererPropertyId::TextureBackgroundDisabled:
+            {
+                m_spriteBackgroundDisabled.setTexture(getSharedRenderer()->getTextureBackgroundDisabled());
+                break;
+            }
+            case RendererPropertyId::TextureArrow:
+            {
+                m_spriteArrow.setTexture(getSharedRenderer()->getTextureArrow());
+                setSize(m_size);
+                break;
+            }
+            case RendererPropertyId::TextureArrowHover:
+            {
+                m_spriteArrowHover.setTexture(getSharedRenderer()->getTextureArrowHover());
+                break;
+            }
+            case RendererPropertyId::TextureArrowDisabled:
+            {
+                m_spriteArrowDisabled.setTexture(getSharedRenderer()->getTextureArrowDisabled());
+                break;
+            }
+            case RendererPropertyId::ListBox:
+            {
+                m_listBox->setRenderer(getSharedRenderer()->getListBox());
+                break;
+            }
+            case RendererPropertyId::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+            case RendererPropertyId::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+            case RendererPropertyId::BackgroundColorDisabled:
+            {
+                m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
+                break;
+            }
+            case RendererPropertyId::ArrowBackgroundColor:
+            {
+                m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
+                break;
+            }
+            case RendererPropertyId::ArrowBackgroundColorHover:
+            {
+                m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
+                break;
+            }
+            case RendererPropertyId::ArrowBackgroundColorDisabled:
+            {
+                m_arrowBackgroundColorDisabledCached = getSharedRenderer()->getArrowBackgroundColorDisabled();
+                break;
+            }
+            case RendererPropertyId::ArrowColor:
+            {
+                m_arrowColorCached = getSharedRenderer()->getArrowColor();
+                break;
+            }
+            case RendererPropertyId::ArrowColorHover:
+            {
+                m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
+                break;
+            }
+            case RendererPropertyId::ArrowColorDisabled:
+            {
+                m_arrowColorDisabledCached = getSharedRenderer()->getArrowColorDisabled();
+                break;
+            }
+            case RendererPropertyId::Opacity:
+            case RendererPropertyId::OpacityDisabled:
+            {
+                Widget::rendererPropertyChanged(property);
 
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_spriteBackgroundDisabled.setOpacity(m_opacityCached);
-            m_spriteArrow.setOpacity(m_opacityCached);
-            m_spriteArrowHover.setOpacity(m_opacityCached);
-            m_spriteArrowDisabled.setOpacity(m_opacityCached);
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_spriteBackgroundDisabled.setOpacity(m_opacityCached);
+                m_spriteArrow.setOpacity(m_opacityCached);
+                m_spriteArrowHover.setOpacity(m_opacityCached);
+                m_spriteArrowDisabled.setOpacity(m_opacityCached);
 
-            m_text.setOpacity(m_opacityCached);
-            m_defaultText.setOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
-        {
-            Widget::rendererChanged(property);
+                m_text.setOpacity(m_opacityCached);
+                m_defaultText.setOpacity(m_opacityCached);
+                break;
+            }
+            case RendererPropertyId::Font:
+            {
+                Widget::rendererPropertyChanged(property);
 
-            m_text.setFont(m_fontCached);
-            m_defaultText.setFont(m_fontCached);
-            m_listBox->setInheritedFont(m_fontCached);
+                m_text.setFont(m_fontCached);
+                m_defaultText.setFont(m_fontCached);
+                m_listBox->setInheritedFont(m_fontCached);
 
-            setSize(m_size);
+                setSize(m_size);
+                break;
+            }
+            default:
+                Widget::rendererPropertyChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -609,6 +609,7 @@ namespace tgui
             return childWidgetUpdated;
 
         m_fileIcons = m_iconLoader->retrieveFileIcons();
+        m_fileIconsRequested = false;
 
         const int oldSelectedItem = m_listView->getSelectedItemIndex();
         sortFilesInListView();
@@ -620,6 +621,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool FileDialog::isUpdateTimeRequired() const
+    {
+        return ChildWindow::isUpdateTimeRequired() || m_fileIconsRequested;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void FileDialog::changePath(const Filesystem::Path& path, bool updateHistory)
     {
         if (updateHistory && (m_currentDirectory != path))
@@ -675,6 +683,8 @@ namespace tgui
         }
 
         m_iconLoader->requestFileIcons(m_filesInDirectory);
+        m_fileIconsRequested = m_iconLoader->supportsSystemIcons();
+        requestTimeUpdates();
 
         m_listView->setVerticalScrollbarValue(0);
         sortFilesInListView();
@@ -1051,92 +1061,106 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void FileDialog::rendererChanged(const String& property)
+    void FileDialog::rendererPropertyChanged(RendererPropertyId property)
     {
-        if (property == U"ListView")
-        {
-            m_listView->setRenderer(getSharedRenderer()->getListView());
-        }
-        else if (property == U"EditBox")
-        {
-            const auto& renderer = getSharedRenderer()->getEditBox();
-            m_editBoxFilename->setRenderer(renderer);
-            m_editBoxPath->setRenderer(renderer);
-        }
-        else if (property == U"Button")
-        {
-            const auto& renderer = getSharedRenderer()->getButton();
-            m_buttonCancel->setRenderer(renderer);
-            m_buttonConfirm->setRenderer(renderer);
-
-            if (!getSharedRenderer()->getBackButton())
-                m_buttonBack->setRenderer(renderer);
-            if (!getSharedRenderer()->getForwardButton())
-                m_buttonForward->setRenderer(renderer);
-            if (!getSharedRenderer()->getUpButton())
-                m_buttonUp->setRenderer(renderer);
-        }
-        else if (property == U"BackButton")
-        {
-            if (getSharedRenderer()->getBackButton())
-                m_buttonBack->setRenderer(getSharedRenderer()->getBackButton());
-            else
-                m_buttonBack->setRenderer(getSharedRenderer()->getButton());
-        }
-        else if (property == U"ForwardButton")
-        {
-            if (getSharedRenderer()->getForwardButton())
-                m_buttonForward->setRenderer(getSharedRenderer()->getForwardButton());
-            else
-                m_buttonForward->setRenderer(getSharedRenderer()->getButton());
-        }
-        else if (property == U"UpButton")
-        {
-            if (getSharedRenderer()->getUpButton())
-                m_buttonUp->setRenderer(getSharedRenderer()->getUpButton());
-            else
-                m_buttonUp->setRenderer(getSharedRenderer()->getButton());
-        }
-        else if (property == U"FilenameLabel")
-        {
-            m_labelFilename->setRenderer(getSharedRenderer()->getFilenameLabel());
-        }
-        else if (property == U"FileTypeComboBox")
-        {
-            m_comboBoxFileTypes->setRenderer(getSharedRenderer()->getFileTypeComboBox());
-        }
-        else if (property == U"ArrowsOnNavigationButtonsVisible")
+        switch (property)
         {
-            if (getSharedRenderer()->getArrowsOnNavigationButtonsVisible())
+            case RendererPropertyId::ListView:
             {
-                m_buttonBack->setText(U"\u2190");
-                m_buttonForward->setText(U"\u2192");
-                m_buttonUp->setText(U"\u2191");
+                m_listView->setRenderer(getSharedRenderer()->getListView());
+                break;
             }
-            else
+            case RendererPropertyId::EditBox:
             {
-                m_buttonBack->setText(U"");
-                m_buttonForward->setText(U"");
-                m_buttonUp->setText(U"");
+                const auto& renderer = getSharedRenderer()->getEditBox();
+                m_editBoxFilename->setRenderer(renderer);
+                m_editBoxPath->setRenderer(renderer);
+                break;
             }
+            case RendererPropertyId::Button:
+            {
+                const auto& renderer = getSharedRenderer()->getButton();
+                m_buttonCancel->setRenderer(renderer);
+                m_buttonConfirm->setRenderer(renderer);
+
+                if (!getSharedRenderer()->getBackButton())
+                    m_buttonBack->setRenderer(renderer);
+                if (!getSharedRenderer()->getForwardButton())
+                    m_buttonForward->setRenderer(renderer);
+                if (!getSharedRenderer()->getUpButton())
+                    m_buttonUp->setRenderer(renderer);
+                break;
+            }
+            case RendererPropertyId::BackButton:
+            {
+                if (getSharedRenderer()->getBackButton())
+                    m_buttonBack->setRenderer(getSharedRenderer()->getBackButton());
+                else
+                    m_buttonBack->setRenderer(getSharedRenderer()->getButton());
+                break;
+            }
+            case RendererPropertyId::ForwardButton:
+            {
+                if (getSharedRenderer()->getForwardButton())
+                    m_buttonForward->setRenderer(getSharedRenderer()->getForwardButton());
+                else
+                    m_buttonForward->setRenderer(getSharedRenderer()->getButton());
+                break;
+            }
+            case RendererPropertyId::UpButton:
+            {
+                if (getSharedRenderer()->getUpButton())
+                    m_buttonUp->setRenderer(getSharedRenderer()->getUpButton());
+                else
+                    m_buttonUp->setRenderer(getSharedRenderer()->getButton());
+                break;
+            }
+            case RendererPropertyId::FilenameLabel:
+            {
+                m_labelFilename->setRenderer(getSharedRenderer()->getFilenameLabel());
+                break;
+            }
+            case RendererPropertyId::FileTypeComboBox:
+            {
+                m_comboBoxFileTypes->setRenderer(getSharedRenderer()->getFileTypeComboBox());
+                break;
+            }
+            case RendererPropertyId::ArrowsOnNavigationButtonsVisible:
+            {
+                if (getSharedRenderer()->getArrowsOnNavigationButtonsVisible())
+                {
+                    m_buttonBack->setText(U"\u2190");
+                    m_buttonForward->setText(U"\u2192");
+                    m_buttonUp->setText(U"\u2191");
+                }
+                else
+                {
+                    m_buttonBack->setText(U"");
+                    m_buttonForward->setText(U"");
+                    m_buttonUp->setText(U"");
+                }
+                break;
+            }
+            case RendererPropertyId::Font:
+            {
+                ChildWindow::rendererPropertyChanged(property);
+
+                m_buttonBack->setInheritedFont(m_fontCached);
+                m_buttonForward->setInheritedFont(m_fontCached);
+                m_buttonUp->setInheritedFont(m_fontCached);
+                m_editBoxPath->setInheritedFont(m_fontCached);
+                m_listView->setInheritedFont(m_fontCached);
+                m_labelFilename->setInheritedFont(m_fontCached);
+                m_editBoxFilename->setInheritedFont(m_fontCached);
+                m_comboBoxFileTypes->setInheritedFont(m_fontCached);
+                m_buttonCancel->setInheritedFont(m_fontCached);
+                m_buttonConfirm->setInheritedFont(m_fontCached);
+                break;
+            }
+            default:
+                ChildWindow::rendererPropertyChanged(property);
+                break;
         }
-        else if (property == U"Font")
-        {
-            ChildWindow::rendererChanged(property);
-
-            m_buttonBack->setInheritedFont(m_fontCached);
-            m_buttonForward->setInheritedFont(m_fontCached);
-            m_buttonUp->setInheritedFont(m_fontCached);
-            m_editBoxPath->setInheritedFont(m_fontCached);
-            m_listView->setInheritedFont(m_fontCached);
-            m_labelFilename->setInheritedFont(m_fontCached);
-            m_editBoxFilename->setInheritedFont(m_fontCached);
-            m_comboBoxFileTypes->setInheritedFont(m_fontCached);
-            m_buttonCancel->setInheritedFont(m_fontCached);
-            m_buttonConfirm->setInheritedFont(m_fontCached);
-        }
-        else
-            ChildWindow::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -133,15 +133,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Group::rendererChanged(const String& property)
+    void Group::rendererPropertyChanged(RendererPropertyId property)
     {
-        if (property == U"Padding")
+        switch (property)
         {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
+            case RendererPropertyId::Padding:
+            {
+                m_paddingCached = getSharedRenderer()->getPadding();
+                setSize(m_size);
+                break;
+            }
+            default:
+                Container::rendererPropertyChanged(property);
+                break;
         }
-        else
-            Container::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
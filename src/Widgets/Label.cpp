@@ -312,6 +312,7 @@ namespace tgui
                 {
                     m_animationTimeElapsed = {};
                     m_possibleDoubleClick = true;
+                    requestTimeUpdates();
                 }
             }
             else // Mouse didn't go down on the label, so this isn't considered a click
@@ -378,99 +379,117 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Label::rendererChanged(const String& property)
+    void Label::rendererPropertyChanged(RendererPropertyId property)
     {
-        if (property == U"Borders")
+        switch (property)
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            m_bordersCached.updateParentSize(getSize());
-            m_spriteBackground.setSize({getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
-                                        getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()});
-            rearrangeText();
-        }
-        else if (property == U"Padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            m_paddingCached.updateParentSize(getSize());
-            rearrangeText();
-        }
-        else if (property == U"TextStyle")
-        {
-            m_textStyleCached = getSharedRenderer()->getTextStyle();
-            rearrangeText();
-        }
-        else if (property == U"TextColor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            for (auto& line : m_lines)
+            case RendererPropertyId::Borders:
             {
-                for (auto& textPiece : line)
-                    textPiece.setColor(m_textColorCached);
+                m_bordersCached = getSharedRenderer()->getBorders();
+                m_bordersCached.updateParentSize(getSize());
+                m_spriteBackground.setSize({getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
+                                            getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()});
+                rearrangeText();
+                break;
             }
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == U"TextOutlineThickness")
-        {
-            m_textOutlineThicknessCached = getSharedRenderer()->getTextOutlineThickness();
-            rearrangeText();
-        }
-        else if (property == U"TextOutlineColor")
-        {
-            m_textOutlineColorCached = getSharedRenderer()->getTextOutlineColor();
-            for (auto& line : m_lines)
+            case RendererPropertyId::Padding:
             {
-                for (auto& textPiece : line)
-                    textPiece.setOutlineColor(m_textOutlineColorCached);
+                m_paddingCached = getSharedRenderer()->getPadding();
+                m_paddingCached.updateParentSize(getSize());
+                rearrangeText();
+                break;
             }
-        }
-        else if (property == U"Scrollbar")
-        {
-            m_scrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+            case RendererPropertyId::TextStyle:
+            {
+                m_textStyleCached = getSharedRenderer()->getTextStyle();
+                rearrangeText();
+                break;
+            }
+            case RendererPropertyId::TextColor:
+            {
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                for (auto& line : m_lines)
+                {
+                    for (auto& textPiece : line)
+                        textPiece.setColor(m_textColorCached);
+                }
+                break;
+            }
+            case RendererPropertyId::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+            case RendererPropertyId::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+            case RendererPropertyId::TextureBackground:
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+            }
+            case RendererPropertyId::TextOutlineThickness:
+            {
+                m_textOutlineThicknessCached = getSharedRenderer()->getTextOutlineThickness();
+                rearrangeText();
+                break;
+            }
+            case RendererPropertyId::TextOutlineColor:
+            {
+                m_textOutlineColorCached = getSharedRenderer()->getTextOutlineColor();
+                for (auto& line : m_lines)
+                {
+                    for (auto& textPiece : line)
+                        textPiece.setOutlineColor(m_textOutlineColorCached);
+                }
+                break;
+            }
+            case RendererPropertyId::Scrollbar:
+            {
+                m_scrollbar->setRenderer(getSharedRenderer()->getScrollbar());
 
-            // If no scrollbar width was set then we may need to use the one from the texture
-            if (getSharedRenderer()->getScrollbarWidth() == 0)
+                // If no scrollbar width was set then we may need to use the one from the texture
+                if (getSharedRenderer()->getScrollbarWidth() == 0)
+                {
+                    m_scrollbar->setSize({m_scrollbar->getDefaultWidth(), m_scrollbar->getSize().y});
+                    rearrangeText();
+                }
+                break;
+            }
+            case RendererPropertyId::ScrollbarWidth:
             {
-                m_scrollbar->setSize({m_scrollbar->getDefaultWidth(), m_scrollbar->getSize().y});
+                const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_scrollbar->getDefaultWidth();
+                m_scrollbar->setSize({width, m_scrollbar->getSize().y});
                 rearrangeText();
+                break;
             }
-        }
-        else if (property == U"ScrollbarWidth")
-        {
-            const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_scrollbar->getDefaultWidth();
-            m_scrollbar->setSize({width, m_scrollbar->getSize().y});
-            rearrangeText();
-        }
-        else if (property == U"Font")
-        {
-            Widget::rendererChanged(property);
-            rearrangeText();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
+            case RendererPropertyId::Font:
+            {
+                Widget::rendererPropertyChanged(property);
+                rearrangeText();
+                break;
+            }
+            case RendererPropertyId::Opacity:
+            case RendererPropertyId::OpacityDisabled:
+            {
+                Widget::rendererPropertyChanged(property);
 
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_scrollbar->setInheritedOpacity(m_opacityCached);
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_scrollbar->setInheritedOpacity(m_opacityCached);
 
-            for (auto& line : m_lines)
-            {
-                for (auto& textPiece : line)
-                    textPiece.setOpacity(m_opacityCached);
+                for (auto& line : m_lines)
+                {
+                    for (auto& textPiece : line)
+                        textPiece.setOpacity(m_opacityCached);
+                }
+                break;
             }
+            default:
+                Widget::rendererPropertyChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -578,6 +597,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Label::isUpdateTimeRequired() const
+    {
+        return ClickableWidget::isUpdateTimeRequired() || m_possibleDoubleClick;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Label::rearrangeText()
     {
         m_lines.clear();
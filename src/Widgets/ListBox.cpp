@@ -637,6 +637,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                requestTimeUpdates();
             }
         }
 
@@ -768,129 +769,152 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListBox::rendererChanged(const String& property)
+    void ListBox::rendererPropertyChanged(RendererPropertyId property)
     {
-        if (property == U"Borders")
+        switch (property)
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == U"Padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == U"TextColor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            updateItemColorsAndStyle();
-        }
-        else if (property == U"TextColorHover")
-        {
-            m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
-            updateItemColorsAndStyle();
-        }
-        else if (property == U"SelectedTextColor")
-        {
-            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
-            updateItemColorsAndStyle();
-        }
-        else if (property == U"SelectedTextColorHover")
-        {
-            m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
-            updateItemColorsAndStyle();
-        }
-        else if (property == U"TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == U"TextStyle")
-        {
-            m_textStyleCached = getSharedRenderer()->getTextStyle();
-
-            for (auto& item : m_items)
-                item.text.setStyle(m_textStyleCached);
-
-            if ((m_selectedItem >= 0) && m_selectedTextStyleCached.isSet())
-                m_items[static_cast<std::size_t>(m_selectedItem)].text.setStyle(m_selectedTextStyleCached);
-        }
-        else if (property == U"SelectedTextStyle")
-        {
-            m_selectedTextStyleCached = getSharedRenderer()->getSelectedTextStyle();
-
-            if (m_selectedItem >= 0)
+            case RendererPropertyId::Borders:
             {
-                if (m_selectedTextStyleCached.isSet())
-                    m_items[static_cast<std::size_t>(m_selectedItem)].text.setStyle(m_selectedTextStyleCached);
-                else
-                    m_items[static_cast<std::size_t>(m_selectedItem)].text.setStyle(m_textStyleCached);
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
             }
-        }
-        else if (property == U"Scrollbar")
-        {
-            m_scroll->setRenderer(getSharedRenderer()->getScrollbar());
-
-            // If no scrollbar width was set then we may need to use the one from the texture
-            if (getSharedRenderer()->getScrollbarWidth() == 0)
+            case RendererPropertyId::Padding:
             {
-                m_scroll->setSize({m_scroll->getDefaultWidth(), m_scroll->getSize().y});
+                m_paddingCached = getSharedRenderer()->getPadding();
                 setSize(m_size);
+                break;
             }
-        }
-        else if (property == U"ScrollbarWidth")
-        {
-            const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_scroll->getDefaultWidth();
-            m_scroll->setSize({width, m_scroll->getSize().y});
-            setSize(m_size);
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"BackgroundColorHover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == U"SelectedBackgroundColor")
-        {
-            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
-        }
-        else if (property == U"SelectedBackgroundColorHover")
-        {
-            m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
+            case RendererPropertyId::TextColor:
+            {
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                updateItemColorsAndStyle();
+                break;
+            }
+            case RendererPropertyId::TextColorHover:
+            {
+                m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
+                updateItemColorsAndStyle();
+                break;
+            }
+            case RendererPropertyId::SelectedTextColor:
+            {
+                m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+                updateItemColorsAndStyle();
+                break;
+            }
+            case RendererPropertyId::SelectedTextColorHover:
+            {
+                m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
+                updateItemColorsAndStyle();
+                break;
+            }
+            case RendererPropertyId::TextureBackground:
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+            }
+            case RendererPropertyId::TextStyle:
+            {
+                m_textStyleCached = getSharedRenderer()->getTextStyle();
 
-            m_scroll->setInheritedOpacity(m_opacityCached);
-            m_spriteBackground.setOpacity(m_opacityCached);
-            for (auto& item : m_items)
-                item.text.setOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
-        {
-            Widget::rendererChanged(property);
+                for (auto& item : m_items)
+                    item.text.setStyle(m_textStyleCached);
 
-            for (auto& item : m_items)
-                item.text.setFont(m_fontCached);
+                if ((m_selectedItem >= 0) && m_selectedTextStyleCached.isSet())
+                    m_items[static_cast<std::size_t>(m_selectedItem)].text.setStyle(m_selectedTextStyleCached);
+                break;
+            }
+            case RendererPropertyId::SelectedTextStyle:
+            {
+                m_selectedTextStyleCached = getSharedRenderer()->getSelectedTextStyle();
+
+                if (m_selectedItem >= 0)
+                {
+                    if (m_selectedTextStyleCached.isSet())
+                        m_items[static_cast<std::size_t>(m_selectedItem)].text.setStyle(m_selectedTextStyleCached);
+                    else
+                        m_items[static_cast<std::size_t>(m_selectedItem)].text.setStyle(m_textStyleCached);
+                }
+                break;
+            }
+            case RendererPropertyId::Scrollbar:
+            {
+                m_scroll->setRenderer(getSharedRenderer()->getScrollbar());
 
-            // Recalculate the text size with the new font
-            if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
+                // If no scrollbar width was set then we may need to use the one from the texture
+                if (getSharedRenderer()->getScrollbarWidth() == 0)
+                {
+                    m_scroll->setSize({m_scroll->getDefaultWidth(), m_scroll->getSize().y});
+                    setSize(m_size);
+                }
+                break;
+            }
+            case RendererPropertyId::ScrollbarWidth:
+            {
+                const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_scroll->getDefaultWidth();
+                m_scroll->setSize({width, m_scroll->getSize().y});
+                setSize(m_size);
+                break;
+            }
+            case RendererPropertyId::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+            case RendererPropertyId::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+            case RendererPropertyId::BackgroundColorHover:
+            {
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+            }
+            case RendererPropertyId::SelectedBackgroundColor:
+            {
+                m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+                break;
+            }
+            case RendererPropertyId::SelectedBackgroundColorHover:
+            {
+                m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
+                break;
+            }
+            case RendererPropertyId::Opacity:
+            case RendererPropertyId::OpacityDisabled:
             {
-                m_textSizeCached = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
+                Widget::rendererPropertyChanged(property);
+
+                m_scroll->setInheritedOpacity(m_opacityCached);
+                m_spriteBackground.setOpacity(m_opacityCached);
                 for (auto& item : m_items)
-                    item.text.setCharacterSize(m_textSizeCached);
+                    item.text.setOpacity(m_opacityCached);
+                break;
             }
+            case RendererPropertyId::Font:
+            {
+                Widget::rendererPropertyChanged(property);
 
-            updateItemPositions();
+                for (auto& item : m_items)
+                    item.text.setFont(m_fontCached);
+
+                // Recalculate the text size with the new font
+                if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
+                {
+                    m_textSizeCached = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
+                    for (auto& item : m_items)
+                        item.text.setCharacterSize(m_textSizeCached);
+                }
+
+                updateItemPositions();
+                break;
+            }
+            default:
+                Widget::rendererPropertyChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1131,6 +1155,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool ListBox::isUpdateTimeRequired() const
+    {
+        return Widget::isUpdateTimeRequired() || m_possibleDoubleClick;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListBox::draw(BackendRenderTarget& target, RenderStates states) const
     {
         const RenderStates statesForScrollbar = states;
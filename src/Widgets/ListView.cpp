@@ -29,6 +29,10 @@
 
 #include <cassert>
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <numeric>
+    #include <thread>
+    #include <system_error>
     #include <cmath>
 #endif
 
@@ -40,6 +44,65 @@
 
 namespace tgui
 {
+    namespace
+    {
+        const String& getItemCellForSorting(const std::vector<Text>& texts, std::size_t column, const String& emptyString)
+        {
+            if (column < texts.size())
+                return texts[column].getString();
+            else
+                return emptyString;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        template <typename Compare>
+        void stableSortOrder(std::vector<std::size_t>& order, const Compare& cmp, bool parallel)
+        {
+            // Splitting the work is only worth it when each thread gets a large enough part of the list
+            constexpr std::size_t minItemsPerThread = 2048;
+            std::size_t chunkCount = 1;
+            if (parallel)
+                chunkCount = std::max<std::size_t>(1, std::min<std::size_t>(std::thread::hardware_concurrency(), order.size() / minItemsPerThread));
+
+            std::vector<std::vector<std::size_t>::iterator> bounds;
+            bounds.reserve(chunkCount + 1);
+            for (std::size_t i = 0; i <= chunkCount; ++i)
+                bounds.push_back(order.begin() + static_cast<std::ptrdiff_t>(order.size() * i / chunkCount));
+
+            // Sort each chunk on its own thread. If a thread can't be created then the chunk is sorted on this thread instead.
+            std::vector<std::thread> threads;
+            threads.reserve(chunkCount - 1);
+            for (std::size_t i = 1; i < chunkCount; ++i)
+            {
+                try
+                {
+                    threads.emplace_back([&bounds,&cmp,i]{ std::stable_sort(bounds[i], bounds[i+1], cmp); });
+                }
+                catch (const std::system_error&)
+                {
+                    break;
+                }
+            }
+
+            std::stable_sort(bounds[0], bounds[1], cmp);
+            for (std::size_t i = threads.size() + 1; i < chunkCount; ++i)
+                std::stable_sort(bounds[i], bounds[i+1], cmp);
+
+            for (auto& thread : threads)
+                thread.join();
+
+            // Merge the sorted chunks pairwise. The merge is stable, so items with equal keys keep their original order.
+            for (std::size_t width = 1; width < chunkCount; width *= 2)
+            {
+                for (std::size_t i = 0; i + width < chunkCount; i += 2 * width)
+                    std::inplace_merge(bounds[i], bounds[i + width], bounds[std::min(i + 2 * width, chunkCount)], cmp);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 #if TGUI_COMPILED_WITH_CPP_VER < 17
     constexpr const char ListView::StaticWidgetType[];
 #endif
@@ -305,9 +368,18 @@ namespace tgui
             updateHorizontalScrollbarMaximum();
         updateVerticalScrollbarMaximum();
 
+        if (m_autoSortCmp)
+        {
+            const std::size_t index = moveAddedItemsToSortedPosition(1);
+
+            // Scroll to the item when auto-scrolling is enabled
+            autoScrollToItem(index);
+
+            return index;
+        }
+
         // Scroll down when auto-scrolling is enabled
-        if (m_autoScroll && (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
-            m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+        autoScrollToBottom();
 
         return m_items.size()-1;
     }
@@ -328,9 +400,18 @@ namespace tgui
             updateHorizontalScrollbarMaximum();
         updateVerticalScrollbarMaximum();
 
+        if (m_autoSortCmp)
+        {
+            const std::size_t index = moveAddedItemsToSortedPosition(1);
+
+            // Scroll to the item when auto-scrolling is enabled
+            autoScrollToItem(index);
+
+            return index;
+        }
+
         // Scroll down when auto-scrolling is enabled
-        if (m_autoScroll && (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
-            m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+        autoScrollToBottom();
 
         return m_items.size()-1;
     }
@@ -357,9 +438,15 @@ namespace tgui
             updateHorizontalScrollbarMaximum();
         updateVerticalScrollbarMaximum();
 
+        // The new items are scattered over the list when they get sorted, so there is nothing to scroll to
+        if (m_autoSortCmp)
+        {
+            moveAddedItemsToSortedPosition(items.size());
+            return;
+        }
+
         // Scroll down when auto-scrolling is enabled
-        if (m_autoScroll && (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
-            m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+        autoScrollToBottom();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -382,8 +469,7 @@ namespace tgui
         updateVerticalScrollbarMaximum();
 
         // Scroll to the item when auto-scrolling is enabled
-        if (m_autoScroll)
-            m_verticalScrollbar->setValue(static_cast<unsigned int>(m_itemHeight * index));
+        autoScrollToItem(index);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -409,8 +495,7 @@ namespace tgui
         updateVerticalScrollbarMaximum();
 
         // Scroll to the item when auto-scrolling is enabled
-        if (m_autoScroll)
-            m_verticalScrollbar->setValue(static_cast<unsigned int>(m_itemHeight * index));
+        autoScrollToItem(index);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -442,8 +527,7 @@ namespace tgui
         updateVerticalScrollbarMaximum();
 
         // Scroll to the item when auto-scrolling is enabled
-        if (m_autoScroll)
-            m_verticalScrollbar->setValue(static_cast<unsigned int>(m_itemHeight * index));
+        autoScrollToItem(index);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -672,6 +756,56 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListView::beginUpdate()
+    {
+        ++m_updateBatchDepth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::endUpdate()
+    {
+        if (m_updateBatchDepth == 0)
+            return;
+
+        --m_updateBatchDepth;
+        if (m_updateBatchDepth > 0)
+            return;
+
+        if (m_lastColumnMaxItemWidthNeedsUpdate)
+        {
+            m_lastColumnMaxItemWidthNeedsUpdate = false;
+            updateLastColumnMaxItemWidth();
+            m_horizontalScrollbarMaximumNeedsUpdate = true;
+        }
+
+        if (m_horizontalScrollbarMaximumNeedsUpdate)
+        {
+            m_horizontalScrollbarMaximumNeedsUpdate = false;
+            updateHorizontalScrollbarMaximum();
+        }
+
+        if (m_verticalScrollbarMaximumNeedsUpdate)
+        {
+            m_verticalScrollbarMaximumNeedsUpdate = false;
+            updateVerticalScrollbarMaximum();
+        }
+
+        // Scrolling had to wait until the maximum of the scrollbar was up-to-date
+        if (m_autoScrollToItemNeedsUpdate)
+        {
+            m_autoScrollToItemNeedsUpdate = false;
+            autoScrollToItem(m_autoScrollItemIndex);
+        }
+        else if (m_autoScrollToBottomNeedsUpdate)
+        {
+            m_autoScrollToBottomNeedsUpdate = false;
+            autoScrollToBottom();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListView::setSelectedItem(std::size_t index)
     {
         if (index >= m_items.size())
@@ -904,22 +1038,47 @@ namespace tgui
 
     void ListView::sort(std::size_t index, const std::function<bool(const String&, const String&)>& cmp)
     {
-        if (index >= m_items.size())
+        sortWithComparator(index, cmp, false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::sortParallel(std::size_t index, const std::function<bool(const String&, const String&)>& cmp)
+    {
+        sortWithComparator(index, cmp, true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::sortByKey(std::size_t index, const std::function<double(const String&)>& keyFunc, bool ascending, bool parallel)
+    {
+        if (m_items.size() < 2)
             return;
 
-        std::sort(m_items.begin(), m_items.end(),
-            [index, &cmp](const ListView::Item &a, const ListView::Item& b)
-            {
-                String s1;
-                if (index < a.texts.size())
-                    s1 = a.texts[index].getString();
+        const String emptyString;
+        std::vector<double> keys(m_items.size());
+        for (std::size_t i = 0; i < m_items.size(); ++i)
+            keys[i] = keyFunc(getItemCellForSorting(m_items[i].texts, index, emptyString));
+
+        std::vector<std::size_t> order(m_items.size());
+        std::iota(order.begin(), order.end(), std::size_t(0));
+        if (ascending)
+            stableSortOrder(order, [&keys](std::size_t a, std::size_t b){ return keys[a] < keys[b]; }, parallel);
+        else
+            stableSortOrder(order, [&keys](std::size_t a, std::size_t b){ return keys[a] > keys[b]; }, parallel);
+
+        applyItemOrder(order);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                String s2;
-                if (index < b.texts.size())
-                    s2 = b.texts[index].getString();
+    void ListView::setAutoSort(std::size_t index, const std::function<bool(const String&, const String&)>& cmp)
+    {
+        m_autoSortColumn = index;
+        m_autoSortCmp = cmp;
 
-                return cmp(s1, s2);
-            });
+        if (m_autoSortCmp)
+            sort(m_autoSortColumn, m_autoSortCmp);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1359,6 +1518,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                requestTimeUpdates();
             }
         }
         // Check if the header was clicked
@@ -1659,158 +1819,184 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListView::rendererChanged(const String& property)
+    void ListView::rendererPropertyChanged(RendererPropertyId property)
     {
-        if (property == U"Borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == U"Padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == U"TextureHeaderBackground")
-        {
-            m_spriteHeaderBackground.setTexture(getSharedRenderer()->getTextureHeaderBackground());
-        }
-        else if (property == U"TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == U"TextColor")
+        switch (property)
         {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            updateItemColors();
+            case RendererPropertyId::Borders:
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
+            }
+            case RendererPropertyId::Padding:
+            {
+                m_paddingCached = getSharedRenderer()->getPadding();
+                setSize(m_size);
+                break;
+            }
+            case RendererPropertyId::TextureHeaderBackground:
+            {
+                m_spriteHeaderBackground.setTexture(getSharedRenderer()->getTextureHeaderBackground());
+                break;
+            }
+            case RendererPropertyId::TextureBackground:
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+            }
+            case RendererPropertyId::TextColor:
+            {
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                updateItemColors();
 
-            if (!m_headerTextColorCached.isSet())
-                updateHeaderTextsColor();
-        }
-        else if (property == U"TextColorHover")
-        {
-            m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
-            updateItemColors();
-        }
-        else if (property == U"SelectedTextColor")
-        {
-            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
-            updateItemColors();
-        }
-        else if (property == U"SelectedTextColorHover")
-        {
-            m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
-            updateItemColors();
-        }
-        else if (property == U"Scrollbar")
-        {
-            m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
-            m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+                if (!m_headerTextColorCached.isSet())
+                    updateHeaderTextsColor();
+                break;
+            }
+            case RendererPropertyId::TextColorHover:
+            {
+                m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
+                updateItemColors();
+                break;
+            }
+            case RendererPropertyId::SelectedTextColor:
+            {
+                m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+                updateItemColors();
+                break;
+            }
+            case RendererPropertyId::SelectedTextColorHover:
+            {
+                m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
+                updateItemColors();
+                break;
+            }
+            case RendererPropertyId::Scrollbar:
+            {
+                m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+                m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
 
-            // If no scrollbar width was set then we may need to use the one from the texture
-            if (getSharedRenderer()->getScrollbarWidth() == 0)
+                // If no scrollbar width was set then we may need to use the one from the texture
+                if (getSharedRenderer()->getScrollbarWidth() == 0)
+                {
+                    m_verticalScrollbar->setSize({m_verticalScrollbar->getDefaultWidth(), m_verticalScrollbar->getSize().y});
+                    m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, m_horizontalScrollbar->getDefaultWidth()});
+                    setSize(m_size);
+                }
+                break;
+            }
+            case RendererPropertyId::ScrollbarWidth:
             {
-                m_verticalScrollbar->setSize({m_verticalScrollbar->getDefaultWidth(), m_verticalScrollbar->getSize().y});
-                m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, m_horizontalScrollbar->getDefaultWidth()});
+                const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
+                m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
+                m_horizontalScrollbar->setSize({m_verticalScrollbar->getSize().x, width});
                 setSize(m_size);
+                break;
             }
-        }
-        else if (property == U"ScrollbarWidth")
-        {
-            const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
-            m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
-            m_horizontalScrollbar->setSize({m_verticalScrollbar->getSize().x, width});
-            setSize(m_size);
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"SeparatorColor")
-        {
-            m_separatorColorCached = getSharedRenderer()->getSeparatorColor();
-        }
-        else if (property == U"GridLinesColor")
-        {
-            m_gridLinesColorCached = getSharedRenderer()->getGridLinesColor();
-        }
-        else if (property == U"HeaderTextColor")
-        {
-            m_headerTextColorCached = getSharedRenderer()->getHeaderTextColor();
-            updateHeaderTextsColor();
-        }
-        else if (property == U"HeaderBackgroundColor")
-        {
-            m_headerBackgroundColorCached = getSharedRenderer()->getHeaderBackgroundColor();
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"BackgroundColorHover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == U"SelectedBackgroundColor")
-        {
-            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
-        }
-        else if (property == U"SelectedBackgroundColorHover")
-        {
-            m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
+            case RendererPropertyId::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+            case RendererPropertyId::SeparatorColor:
+            {
+                m_separatorColorCached = getSharedRenderer()->getSeparatorColor();
+                break;
+            }
+            case RendererPropertyId::GridLinesColor:
+            {
+                m_gridLinesColorCached = getSharedRenderer()->getGridLinesColor();
+                break;
+            }
+            case RendererPropertyId::HeaderTextColor:
+            {
+                m_headerTextColorCached = getSharedRenderer()->getHeaderTextColor();
+                updateHeaderTextsColor();
+                break;
+            }
+            case RendererPropertyId::HeaderBackgroundColor:
+            {
+                m_headerBackgroundColorCached = getSharedRenderer()->getHeaderBackgroundColor();
+                break;
+            }
+            case RendererPropertyId::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+            case RendererPropertyId::BackgroundColorHover:
+            {
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+            }
+            case RendererPropertyId::SelectedBackgroundColor:
+            {
+                m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+                break;
+            }
+            case RendererPropertyId::SelectedBackgroundColorHover:
+            {
+                m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
+                break;
+            }
+            case RendererPropertyId::Opacity:
+            case RendererPropertyId::OpacityDisabled:
+            {
+                Widget::rendererPropertyChanged(property);
 
-            m_verticalScrollbar->setInheritedOpacity(m_opacityCached);
-            m_horizontalScrollbar->setInheritedOpacity(m_opacityCached);
+                m_verticalScrollbar->setInheritedOpacity(m_opacityCached);
+                m_horizontalScrollbar->setInheritedOpacity(m_opacityCached);
 
-            m_spriteHeaderBackground.setOpacity(m_opacityCached);
-            m_spriteBackground.setOpacity(m_opacityCached);
+                m_spriteHeaderBackground.setOpacity(m_opacityCached);
+                m_spriteBackground.setOpacity(m_opacityCached);
 
-            for (auto& column : m_columns)
-                column.text.setOpacity(m_opacityCached);
+                for (auto& column : m_columns)
+                    column.text.setOpacity(m_opacityCached);
 
-            for (auto& item : m_items)
-            {
-                for (auto& text : item.texts)
-                    text.setOpacity(m_opacityCached);
+                for (auto& item : m_items)
+                {
+                    for (auto& text : item.texts)
+                        text.setOpacity(m_opacityCached);
 
-                item.icon.setOpacity(m_opacityCached);
+                    item.icon.setOpacity(m_opacityCached);
+                }
+                break;
             }
-        }
-        else if (property == U"Font")
-        {
-            Widget::rendererChanged(property);
-
-            for (auto& column : m_columns)
-                column.text.setFont(m_fontCached);
-
-            for (auto& item : m_items)
+            case RendererPropertyId::Font:
             {
-                for (auto& text : item.texts)
-                    text.setFont(m_fontCached);
-            }
+                Widget::rendererPropertyChanged(property);
 
-            if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
-            {
-                // Recalculate the text size with the new font
-                updateTextSize();
-            }
-            else
-            {
-                // Recalculate the width of the columns if they depended on the header text
                 for (auto& column : m_columns)
+                    column.text.setFont(m_fontCached);
+
+                for (auto& item : m_items)
                 {
-                    if (column.designWidth == 0)
-                        column.width = calculateAutoColumnWidth(column.text);
+                    for (auto& text : item.texts)
+                        text.setFont(m_fontCached);
                 }
-                updateHorizontalScrollbarMaximum();
+
+                if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
+                {
+                    // Recalculate the text size with the new font
+                    updateTextSize();
+                }
+                else
+                {
+                    // Recalculate the width of the columns if they depended on the header text
+                    for (auto& column : m_columns)
+                    {
+                        if (column.designWidth == 0)
+                            column.width = calculateAutoColumnWidth(column.text);
+                    }
+                    updateHorizontalScrollbarMaximum();
+                }
+                break;
             }
+            default:
+                Widget::rendererPropertyChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2264,6 +2450,13 @@ namespace tgui
         if (!m_columns.empty() && !m_expandLastColumn)
             return updatedLastColumnMaxItemWidth;
 
+        // Looping over all items is postponed until the batch of changes has ended
+        if (m_updateBatchDepth > 0)
+        {
+            m_lastColumnMaxItemWidthNeedsUpdate = true;
+            return updatedLastColumnMaxItemWidth;
+        }
+
         const float textPadding = Text::getExtraHorizontalOffset(m_fontCached, m_textSizeCached);
         if (m_columns.empty())
         {
@@ -2348,6 +2541,111 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListView::sortWithComparator(std::size_t index, const std::function<bool(const String&, const String&)>& cmp, bool parallel)
+    {
+        if (m_items.size() < 2)
+            return;
+
+        // Sort the indices of the items instead of the items themselves, the items are only moved once at the end
+        const String emptyString;
+        std::vector<const String*> keys(m_items.size());
+        for (std::size_t i = 0; i < m_items.size(); ++i)
+            keys[i] = &getItemCellForSorting(m_items[i].texts, index, emptyString);
+
+        std::vector<std::size_t> order(m_items.size());
+        std::iota(order.begin(), order.end(), std::size_t(0));
+        stableSortOrder(order, [&keys,&cmp](std::size_t a, std::size_t b){ return cmp(*keys[a], *keys[b]); }, parallel);
+
+        applyItemOrder(order);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::applyItemOrder(const std::vector<std::size_t>& order)
+    {
+        std::vector<Item> items;
+        items.reserve(m_items.size());
+        for (const std::size_t oldIndex : order)
+            items.push_back(std::move(m_items[oldIndex]));
+        m_items = std::move(items);
+
+        std::vector<std::size_t> newIndices(order.size());
+        for (std::size_t i = 0; i < order.size(); ++i)
+            newIndices[order[i]] = i;
+
+        std::set<std::size_t> selectedItems;
+        for (const std::size_t selectedItem : m_selectedItems)
+            selectedItems.insert(newIndices[selectedItem]);
+        m_selectedItems = std::move(selectedItems);
+
+        for (int* itemIndex : {&m_hoveredItem, &m_firstSelectedItemIndex, &m_focusedItemIndex})
+        {
+            if ((*itemIndex >= 0) && (static_cast<std::size_t>(*itemIndex) < newIndices.size()))
+                *itemIndex = static_cast<int>(newIndices[static_cast<std::size_t>(*itemIndex)]);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListView::moveAddedItemsToSortedPosition(std::size_t addedItemCount)
+    {
+        const std::size_t oldItemCount = m_items.size() - addedItemCount;
+        if (addedItemCount == 0)
+            return m_items.size() - 1;
+
+        const String emptyString;
+
+        if (addedItemCount == 1)
+        {
+            // Use a binary search to find the location of the item, placing it behind items that compare equal
+            const String& key = getItemCellForSorting(m_items.back().texts, m_autoSortColumn, emptyString);
+            const auto it = std::upper_bound(m_items.begin(), m_items.end() - 1, key,
+                [this,&emptyString](const String& value, const Item& item)
+                { return m_autoSortCmp(value, getItemCellForSorting(item.texts, m_autoSortColumn, emptyString)); });
+
+            const std::size_t index = static_cast<std::size_t>(it - m_items.begin());
+            if (index == oldItemCount)
+                return index;
+
+            std::rotate(it, m_items.end() - 1, m_items.end());
+
+            std::set<std::size_t> selectedItems;
+            for (const std::size_t selectedItem : m_selectedItems)
+                selectedItems.insert((selectedItem >= index) ? selectedItem + 1 : selectedItem);
+            m_selectedItems = std::move(selectedItems);
+
+            for (int* itemIndex : {&m_hoveredItem, &m_firstSelectedItemIndex, &m_focusedItemIndex})
+            {
+                if (*itemIndex >= static_cast<int>(index))
+                    ++*itemIndex;
+            }
+
+            return index;
+        }
+
+        // Sort the new items among themselves and then merge them with the already sorted items
+        std::vector<const String*> keys(m_items.size());
+        for (std::size_t i = 0; i < m_items.size(); ++i)
+            keys[i] = &getItemCellForSorting(m_items[i].texts, m_autoSortColumn, emptyString);
+
+        const auto cmp = [this,&keys](std::size_t a, std::size_t b){ return m_autoSortCmp(*keys[a], *keys[b]); };
+
+        std::vector<std::size_t> addedOrder(addedItemCount);
+        std::iota(addedOrder.begin(), addedOrder.end(), oldItemCount);
+        std::stable_sort(addedOrder.begin(), addedOrder.end(), cmp);
+
+        std::vector<std::size_t> oldOrder(oldItemCount);
+        std::iota(oldOrder.begin(), oldOrder.end(), std::size_t(0));
+
+        std::vector<std::size_t> order(m_items.size());
+        std::merge(oldOrder.begin(), oldOrder.end(), addedOrder.begin(), addedOrder.end(), order.begin(), cmp);
+        applyItemOrder(order);
+
+        return static_cast<std::size_t>(std::find(order.begin(), order.end(), m_items.size() - 1) - order.begin());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool ListView::updateLastColumnMaxItemWidthWithModifiedItem(const Item& modifiedItem, float oldDesiredWidthInLastColumn)
     {
         bool updatedLastColumnMaxItemWidth = updateLastColumnMaxItemWidthWithNewItem(modifiedItem);
@@ -2604,8 +2902,53 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListView::autoScrollToItem(std::size_t index)
+    {
+        if (!m_autoScroll)
+            return;
+
+        // Postpone scrolling until the batch of changes has ended, as the scrollbar maximum isn't updated until then
+        if (m_updateBatchDepth > 0)
+        {
+            m_autoScrollToItemNeedsUpdate = true;
+            m_autoScrollToBottomNeedsUpdate = false;
+            m_autoScrollItemIndex = index;
+            return;
+        }
+
+        m_verticalScrollbar->setValue(static_cast<unsigned int>(m_itemHeight * index));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::autoScrollToBottom()
+    {
+        if (!m_autoScroll)
+            return;
+
+        // Postpone scrolling until the batch of changes has ended, as the scrollbar maximum isn't updated until then
+        if (m_updateBatchDepth > 0)
+        {
+            m_autoScrollToBottomNeedsUpdate = true;
+            m_autoScrollToItemNeedsUpdate = false;
+            return;
+        }
+
+        if (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum())
+            m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListView::updateVerticalScrollbarMaximum()
     {
+        // Postpone the update until the batch of changes has ended
+        if (m_updateBatchDepth > 0)
+        {
+            m_verticalScrollbarMaximumNeedsUpdate = true;
+            return;
+        }
+
         const bool verticalScrollbarAtBottom = (m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize() >= m_verticalScrollbar->getMaximum());
 
         unsigned int maximum = static_cast<unsigned int>(m_items.size() * m_itemHeight);
@@ -2624,6 +2967,13 @@ namespace tgui
 
     void ListView::updateHorizontalScrollbarMaximum()
     {
+        // Postpone the update until the batch of changes has ended
+        if (m_updateBatchDepth > 0)
+        {
+            m_horizontalScrollbarMaximumNeedsUpdate = true;
+            return;
+        }
+
         float maxWidth = 0;
 
         if (!m_headerVisible || m_columns.empty())
@@ -2763,6 +3113,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool ListView::isUpdateTimeRequired() const
+    {
+        return Widget::isUpdateTimeRequired() || m_possibleDoubleClick;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListView::draw(BackendRenderTarget& target, RenderStates states) const
     {
         const RenderStates statesForScrollbar = states;
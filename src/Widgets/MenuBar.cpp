@@ -750,76 +750,96 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void MenuBar::rendererChanged(const String& property)
+    void MenuBar::rendererPropertyChanged(RendererPropertyId property)
     {
-        if (property == U"TextColor")
+        switch (property)
         {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            updateTextColors(m_menus, m_visibleMenu);
-        }
-        else if (property == U"SelectedTextColor")
-        {
-            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
-            updateTextColors(m_menus, m_visibleMenu);
-        }
-        else if (property == U"TextColorDisabled")
-        {
-            m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
-            updateTextColors(m_menus, m_visibleMenu);
-        }
-        else if (property == U"TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == U"TextureItemBackground")
-        {
-            m_spriteItemBackground.setTexture(getSharedRenderer()->getTextureItemBackground());
-        }
-        else if (property == U"TextureSelectedItemBackground")
-        {
-            m_spriteSelectedItemBackground.setTexture(getSharedRenderer()->getTextureSelectedItemBackground());
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"SelectedBackgroundColor")
-        {
-            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
-        }
-        else if (property == U"DistanceToSide")
-        {
-            m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
-        }
-        else if (property == U"SeparatorColor")
-        {
-            m_separatorColorCached = getSharedRenderer()->getSeparatorColor();
-        }
-        else if (property == U"SeparatorThickness")
-        {
-            m_separatorThicknessCached = getSharedRenderer()->getSeparatorThickness();
-        }
-        else if (property == U"SeparatorVerticalPadding")
-        {
-            m_separatorVerticalPaddingCached = getSharedRenderer()->getSeparatorVerticalPadding();
-        }
-        else if (property == U"SeparatorSidePadding")
-        {
-            m_separatorSidePaddingCached = getSharedRenderer()->getSeparatorSidePadding();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
-            updateTextOpacity(m_menus);
-            m_spriteBackground.setOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
-        {
-            Widget::rendererChanged(property);
-            updateTextFont(m_menus);
+            case RendererPropertyId::TextColor:
+            {
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                updateTextColors(m_menus, m_visibleMenu);
+                break;
+            }
+            case RendererPropertyId::SelectedTextColor:
+            {
+                m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+                updateTextColors(m_menus, m_visibleMenu);
+                break;
+            }
+            case RendererPropertyId::TextColorDisabled:
+            {
+                m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
+                updateTextColors(m_menus, m_visibleMenu);
+                break;
+            }
+            case RendererPropertyId::TextureBackground:
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+            }
+            case RendererPropertyId::TextureItemBackground:
+            {
+                m_spriteItemBackground.setTexture(getSharedRenderer()->getTextureItemBackground());
+                break;
+            }
+            case RendererPropertyId::TextureSelectedItemBackground:
+            {
+                m_spriteSelectedItemBackground.setTexture(getSharedRenderer()->getTextureSelectedItemBackground());
+                break;
+            }
+            case RendererPropertyId::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+            case RendererPropertyId::SelectedBackgroundColor:
+            {
+                m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+                break;
+            }
+            case RendererPropertyId::DistanceToSide:
+            {
+                m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
+                break;
+            }
+            case RendererPropertyId::SeparatorColor:
+            {
+                m_separatorColorCached = getSharedRenderer()->getSeparatorColor();
+                break;
+            }
+            case RendererPropertyId::SeparatorThickness:
+            {
+                m_separatorThicknessCached = getSharedRenderer()->getSeparatorThickness();
+                break;
+            }
+            case RendererPropertyId::SeparatorVerticalPadding:
+            {
+                m_separatorVerticalPaddingCached = getSharedRenderer()->getSeparatorVerticalPadding();
+                break;
+            }
+            case RendererPropertyId::SeparatorSidePadding:
+            {
+                m_separatorSidePaddingCached = getSharedRenderer()->getSeparatorSidePadding();
+                break;
+            }
+            case RendererPropertyId::Opacity:
+            case RendererPropertyId::OpacityDisabled:
+            {
+                Widget::rendererPropertyChanged(property);
+                updateTextOpacity(m_menus);
+                m_spriteBackground.setOpacity(m_opacityCached);
+                break;
+            }
+            case RendererPropertyId::Font:
+            {
+                Widget::rendererPropertyChanged(property);
+                updateTextFont(m_menus);
+                break;
+            }
+            default:
+                Widget::rendererPropertyChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1608,6 +1628,7 @@ namespace tgui
         Widget{"MenuBarMenuPlaceholder", true},
         m_menuBar{menuBar}
     {
+        m_hitAreaLimitedToSize = false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -403,31 +403,38 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void MessageBox::rendererChanged(const String& property)
+    void MessageBox::rendererPropertyChanged(RendererPropertyId property)
     {
-        if (property == U"TextColor")
+        switch (property)
         {
-            m_label->getRenderer()->setTextColor(getSharedRenderer()->getTextColor());
-        }
-        else if (property == U"Button")
-        {
-            const auto& renderer = getSharedRenderer()->getButton();
-            for (auto& button : m_buttons)
-                button->setRenderer(renderer);
-        }
-        else if (property == U"Font")
-        {
-            ChildWindow::rendererChanged(property);
+            case RendererPropertyId::TextColor:
+            {
+                m_label->getRenderer()->setTextColor(getSharedRenderer()->getTextColor());
+                break;
+            }
+            case RendererPropertyId::Button:
+            {
+                const auto& renderer = getSharedRenderer()->getButton();
+                for (auto& button : m_buttons)
+                    button->setRenderer(renderer);
+                break;
+            }
+            case RendererPropertyId::Font:
+            {
+                ChildWindow::rendererPropertyChanged(property);
 
-            m_label->setInheritedFont(m_fontCached);
+                m_label->setInheritedFont(m_fontCached);
 
-            for (auto& button : m_buttons)
-                button->setInheritedFont(m_fontCached);
+                for (auto& button : m_buttons)
+                    button->setInheritedFont(m_fontCached);
 
-            rearrange();
+                rearrange();
+                break;
+            }
+            default:
+                ChildWindow::rendererPropertyChanged(property);
+                break;
         }
-        else
-            ChildWindow::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
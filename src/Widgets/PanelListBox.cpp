@@ -25,6 +25,12 @@
 
 #include <TGUI/Widgets/PanelListBox.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <cmath>
+    #include <limits>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui 
@@ -58,6 +64,114 @@ namespace tgui
             m_renderer = aurora::makeCopied<PanelListBoxRenderer>();
             setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
         }
+
+        connectVerticalScrollbar();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PanelListBox::PanelListBox(const PanelListBox& other) :
+        ScrollablePanel                          {other},
+        onItemSelect                             {other.onItemSelect},
+        m_items                                  {other.m_items},
+        m_maxItems                               {other.m_maxItems},
+        m_panelTemplate                          {other.m_panelTemplate},
+        m_recyclingMode                          {other.m_recyclingMode},
+        m_recycledItemCount                      {other.m_recycledItemCount},
+        m_recycledPanels                         {other.m_recycledPanels},
+        m_bindItemFunc                           {other.m_bindItemFunc},
+        m_createItemFunc                         {other.m_createItemFunc},
+        m_selectedItem                           {other.m_selectedItem},
+        m_hoveringItem                           {other.m_hoveringItem},
+        m_itemsBackgroundColorCached             {other.m_itemsBackgroundColorCached},
+        m_itemsBackgroundColorHoverCached        {other.m_itemsBackgroundColorHoverCached},
+        m_selectedItemsBackgroundColorCached     {other.m_selectedItemsBackgroundColorCached},
+        m_selectedItemsBackgroundColorHoverCached{other.m_selectedItemsBackgroundColorHoverCached}
+    {
+        copyItemPanels(other);
+        connectVerticalScrollbar();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PanelListBox::PanelListBox(PanelListBox&& other) noexcept :
+        ScrollablePanel                          {std::move(other)},
+        onItemSelect                             {std::move(other.onItemSelect)},
+        m_items                                  {std::move(other.m_items)},
+        m_maxItems                               {std::move(other.m_maxItems)},
+        m_panelTemplate                          {std::move(other.m_panelTemplate)},
+        m_recyclingMode                          {std::move(other.m_recyclingMode)},
+        m_recycledItemCount                      {std::move(other.m_recycledItemCount)},
+        m_recycledPanels                         {std::move(other.m_recycledPanels)},
+        m_bindItemFunc                           {std::move(other.m_bindItemFunc)},
+        m_createItemFunc                         {std::move(other.m_createItemFunc)},
+        m_selectedItem                           {std::move(other.m_selectedItem)},
+        m_hoveringItem                           {std::move(other.m_hoveringItem)},
+        m_itemsBackgroundColorCached             {std::move(other.m_itemsBackgroundColorCached)},
+        m_itemsBackgroundColorHoverCached        {std::move(other.m_itemsBackgroundColorHoverCached)},
+        m_selectedItemsBackgroundColorCached     {std::move(other.m_selectedItemsBackgroundColorCached)},
+        m_selectedItemsBackgroundColorHoverCached{std::move(other.m_selectedItemsBackgroundColorHoverCached)}
+    {
+        connectVerticalScrollbar();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PanelListBox& PanelListBox::operator= (const PanelListBox& other)
+    {
+        if (this != &other)
+        {
+            ScrollablePanel::operator=(other);
+            onItemSelect                              = other.onItemSelect;
+            m_items                                   = other.m_items;
+            m_maxItems                                = other.m_maxItems;
+            m_panelTemplate                           = other.m_panelTemplate;
+            m_recyclingMode                           = other.m_recyclingMode;
+            m_recycledItemCount                       = other.m_recycledItemCount;
+            m_recycledPanels                          = other.m_recycledPanels;
+            m_bindItemFunc                            = other.m_bindItemFunc;
+            m_createItemFunc                          = other.m_createItemFunc;
+            m_selectedItem                            = other.m_selectedItem;
+            m_hoveringItem                            = other.m_hoveringItem;
+            m_itemsBackgroundColorCached              = other.m_itemsBackgroundColorCached;
+            m_itemsBackgroundColorHoverCached         = other.m_itemsBackgroundColorHoverCached;
+            m_selectedItemsBackgroundColorCached      = other.m_selectedItemsBackgroundColorCached;
+            m_selectedItemsBackgroundColorHoverCached = other.m_selectedItemsBackgroundColorHoverCached;
+
+            copyItemPanels(other);
+            connectVerticalScrollbar();
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PanelListBox& PanelListBox::operator= (PanelListBox&& other) noexcept
+    {
+        if (this != &other)
+        {
+            onItemSelect                              = std::move(other.onItemSelect);
+            m_items                                   = std::move(other.m_items);
+            m_maxItems                                = std::move(other.m_maxItems);
+            m_panelTemplate                           = std::move(other.m_panelTemplate);
+            m_recyclingMode                           = std::move(other.m_recyclingMode);
+            m_recycledItemCount                       = std::move(other.m_recycledItemCount);
+            m_recycledPanels                          = std::move(other.m_recycledPanels);
+            m_bindItemFunc                            = std::move(other.m_bindItemFunc);
+            m_createItemFunc                          = std::move(other.m_createItemFunc);
+            m_selectedItem                            = std::move(other.m_selectedItem);
+            m_hoveringItem                            = std::move(other.m_hoveringItem);
+            m_itemsBackgroundColorCached              = std::move(other.m_itemsBackgroundColorCached);
+            m_itemsBackgroundColorHoverCached         = std::move(other.m_itemsBackgroundColorHoverCached);
+            m_selectedItemsBackgroundColorCached      = std::move(other.m_selectedItemsBackgroundColorCached);
+            m_selectedItemsBackgroundColorHoverCached = std::move(other.m_selectedItemsBackgroundColorHoverCached);
+            ScrollablePanel::operator=(std::move(other));
+
+            connectVerticalScrollbar();
+        }
+
+        return *this;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -113,6 +227,9 @@ namespace tgui
 
     Panel::Ptr PanelListBox::addItem(const String& id, int index)
     {
+        if (m_recyclingMode)
+            return nullptr;
+
         if (m_maxItems > 0 && m_items.size() >= m_maxItems)
             return nullptr;
 
@@ -121,7 +238,7 @@ namespace tgui
         index = index != -1 ? index : static_cast<int>(getItemCount());
         m_items.insert(m_items.begin() + index, Item{newPanel, id});
 
-        updateItemsPositions();
+        updateItemsPositions(static_cast<std::size_t>(index));
 
         ScrollablePanel::add(newPanel, id);
 
@@ -130,6 +247,52 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void PanelListBox::setRecyclingMode(std::size_t itemCount, const BindItemFunc& bindItem, const CreateItemFunc& createItem)
+    {
+        removeAllItems();
+
+        m_recyclingMode = true;
+        m_recycledItemCount = itemCount;
+        m_bindItemFunc = bindItem;
+        m_createItemFunc = createItem;
+
+        updateItemsPositions();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool PanelListBox::isRecyclingMode() const
+    {
+        return m_recyclingMode;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PanelListBox::setRecycledItemCount(std::size_t itemCount)
+    {
+        if (!m_recyclingMode)
+            return;
+
+        updateHoveringItem(-1);
+        if (m_selectedItem >= static_cast<int>(itemCount))
+            updateSelectedItem(-1);
+
+        m_recycledItemCount = itemCount;
+
+        // The content size changes, which may change the scrollbar value and thus update the panels, so force the rebind afterwards
+        updateItemsPositions();
+        updateRecycledPanels(true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PanelListBox::refreshRecycledItems()
+    {
+        updateRecycledPanels(true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Panel::Ptr PanelListBox::getPanelTemplate()
     {
         return m_panelTemplate;
@@ -202,7 +365,7 @@ namespace tgui
 
     bool PanelListBox::setSelectedItemByIndex(const std::size_t index)
     {
-        if (index >= m_items.size())
+        if (index >= getItemCount())
         {
             deselectItem();
             return false;
@@ -266,7 +429,7 @@ namespace tgui
         ScrollablePanel::remove(m_items[index].panel);
         m_items.erase(m_items.begin() + static_cast<std::ptrdiff_t>(index));
 
-        updateItemsPositions();
+        updateItemsPositions(index);
 
         return true;
     }
@@ -280,6 +443,16 @@ namespace tgui
     
         m_items.clear();
         ScrollablePanel::removeAllWidgets();
+
+        if (m_recyclingMode)
+        {
+            m_recyclingMode = false;
+            m_recycledItemCount = 0;
+            m_recycledPanels.clear();
+            m_bindItemFunc = nullptr;
+            m_createItemFunc = nullptr;
+            setContentSize({0, 0});
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -299,6 +472,15 @@ namespace tgui
 
     Panel::Ptr PanelListBox::getItemByIndex(const std::size_t index) const
     {
+        if (m_recyclingMode)
+        {
+            if (m_recycledPanels.empty())
+                return nullptr;
+
+            const auto& recycledPanel = m_recycledPanels[index % m_recycledPanels.size()];
+            return (recycledPanel.index == index) ? recycledPanel.panel : nullptr;
+        }
+
         if (index >= m_items.size())
             return nullptr;
     
@@ -322,6 +504,17 @@ namespace tgui
 
     int PanelListBox::getIndexByItem(const Panel::Ptr& panelPtr) const
     {
+        if (m_recyclingMode)
+        {
+            for (const auto& recycledPanel : m_recycledPanels)
+            {
+                if ((recycledPanel.panel == panelPtr) && (recycledPanel.index < m_recycledItemCount))
+                    return static_cast<int>(recycledPanel.index);
+            }
+
+            return -1;
+        }
+
         for (std::size_t i = 0; i < m_items.size(); ++i)
         {
             if (m_items[i].panel == panelPtr)
@@ -345,14 +538,14 @@ namespace tgui
 
     Panel::Ptr PanelListBox::getSelectedItem() const
     {
-        return m_selectedItem >= 0 ? m_items[static_cast<std::size_t>(m_selectedItem)].panel : nullptr;
+        return m_selectedItem >= 0 ? getItemByIndex(static_cast<std::size_t>(m_selectedItem)) : nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     String PanelListBox::getSelectedItemId() const
     {
-        return m_selectedItem >= 0 ? m_items[static_cast<std::size_t>(m_selectedItem)].id : std::string();
+        return m_selectedItem >= 0 ? getIdByIndex(static_cast<std::size_t>(m_selectedItem)) : std::string();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -366,6 +559,9 @@ namespace tgui
 
     std::size_t PanelListBox::getItemCount() const
     {
+        if (m_recyclingMode)
+            return m_recycledItemCount;
+
         return m_items.size();
     }
 
@@ -491,31 +687,37 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void PanelListBox::rendererChanged(const String& property)
+    void PanelListBox::rendererPropertyChanged(RendererPropertyId property)
     {
-        if (property == "ItemsBackgroundColor")
-        {
-            m_itemsBackgroundColorCached = getSharedRenderer()->getItemsBackgroundColor();
-            m_panelTemplate->getSharedRenderer()->setBackgroundColor(m_itemsBackgroundColorCached);
-        }
-        else if (property == "ItemsBackgroundColorHover")
-        {
-            m_itemsBackgroundColorHoverCached = getSharedRenderer()->getItemsBackgroundColorHover();
-            updateSelectedAndHoveringItemColorsAndStyle();
-        }
-        else if (property == "SelectedItemsBackgroundColor")
-        {
-            m_selectedItemsBackgroundColorCached = getSharedRenderer()->getSelectedItemsBackgroundColor();
-            updateSelectedAndHoveringItemColorsAndStyle();
-        }
-        else if (property == "SelectedItemsBackgroundColorHover")
+        switch (property)
         {
-            m_selectedItemsBackgroundColorHoverCached = getSharedRenderer()->getSelectedItemsBackgroundColorHover();
-            updateSelectedAndHoveringItemColorsAndStyle();
-        }
-        else
-        {
-            ScrollablePanel::rendererChanged(property);
+            case RendererPropertyId::ItemsBackgroundColor:
+            {
+                m_itemsBackgroundColorCached = getSharedRenderer()->getItemsBackgroundColor();
+                m_panelTemplate->getSharedRenderer()->setBackgroundColor(m_itemsBackgroundColorCached);
+                break;
+            }
+            case RendererPropertyId::ItemsBackgroundColorHover:
+            {
+                m_itemsBackgroundColorHoverCached = getSharedRenderer()->getItemsBackgroundColorHover();
+                updateSelectedAndHoveringItemColorsAndStyle();
+                break;
+            }
+            case RendererPropertyId::SelectedItemsBackgroundColor:
+            {
+                m_selectedItemsBackgroundColorCached = getSharedRenderer()->getSelectedItemsBackgroundColor();
+                updateSelectedAndHoveringItemColorsAndStyle();
+                break;
+            }
+            case RendererPropertyId::SelectedItemsBackgroundColorHover:
+            {
+                m_selectedItemsBackgroundColorHoverCached = getSharedRenderer()->getSelectedItemsBackgroundColorHover();
+                updateSelectedAndHoveringItemColorsAndStyle();
+                break;
+            }
+            default:
+                ScrollablePanel::rendererPropertyChanged(property);
+                break;
         }
     }
 
@@ -525,7 +727,20 @@ namespace tgui
     {
         auto node = ScrollablePanel::save(renderers);
 
-        if (m_selectedItem >= 0)
+        // The panels that are reused in recycling mode don't belong to items that are stored in the list box.
+        // Their nodes are the last children of the node, in the same order as the child widgets.
+        if (m_recyclingMode)
+        {
+            const std::size_t firstWidgetNode = node->children.size() - m_widgets.size();
+            for (std::size_t i = m_widgets.size(); i > 0; --i)
+            {
+                const auto isRecycledPanel = [&widget=m_widgets[i-1]](const RecycledPanel& recycledPanel){ return recycledPanel.panel == widget; };
+                if (std::any_of(m_recycledPanels.begin(), m_recycledPanels.end(), isRecycledPanel))
+                    node->children.erase(node->children.begin() + static_cast<std::ptrdiff_t>(firstWidgetNode + i - 1));
+            }
+        }
+
+        if ((m_selectedItem >= 0) && !m_recyclingMode)
             node->propertyValuePairs[U"SelectedItemIndex"] = std::make_unique<DataIO::ValueNode>(String::fromNumber(getSelectedItemIndex()));
 
         node->propertyValuePairs[U"ItemsHeight"] = std::make_unique<DataIO::ValueNode>(String::fromNumber(getItemsHeight().getValue()));
@@ -593,9 +808,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void PanelListBox::updateItemsPositions() const
+    void PanelListBox::updateItemsPositions(std::size_t firstIndex) const
     {
-        for (std::size_t i = 0; i < getItemCount(); ++i)
+        if (m_recyclingMode)
+        {
+            // There are no panels for most items, so the scrollbar can't be based on the positions of the child widgets.
+            // Changing the content size and adding panels modifies the list box itself, which the setters of the item size
+            // can't do directly because they are const. The list box is never created as a const object, so casting is safe.
+            auto* const self = const_cast<PanelListBox*>(this); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+            self->setContentSize({m_panelTemplate->getSize().x, static_cast<float>(m_recycledItemCount) * m_panelTemplate->getSize().y});
+            self->updateRecycledPanels();
+            return;
+        }
+
+        for (std::size_t i = firstIndex; i < m_items.size(); ++i)
         {
             const auto itemVerticalPosition = i * getItemsHeight();
             m_items[i].panel->setPosition(0, itemVerticalPosition);
@@ -608,6 +834,102 @@ namespace tgui
     {
         for (const auto& item : m_items)
             item.panel->setSize(m_panelTemplate->getSize());
+
+        for (const auto& recycledPanel : m_recycledPanels)
+            recycledPanel.panel->setSize(m_panelTemplate->getSize());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PanelListBox::updateRecycledPanels(bool rebindAll)
+    {
+        if (!m_recyclingMode)
+            return;
+
+        // Find the items that are inside the visible area
+        const float itemHeight = m_panelTemplate->getSize().y;
+        std::size_t firstIndex = 0;
+        std::size_t endIndex = 0;
+        if ((itemHeight > 0) && (m_recycledItemCount > 0))
+        {
+            const float scrollOffset = static_cast<float>(m_verticalScrollbar->getValue());
+            firstIndex = std::min(m_recycledItemCount, static_cast<std::size_t>(scrollOffset / itemHeight));
+            endIndex = std::min(m_recycledItemCount, static_cast<std::size_t>(std::ceil((scrollOffset + getInnerSize().y) / itemHeight)));
+        }
+
+        // Create more panels if there aren't enough to fill the visible area.
+        // Which panel shows which item depends on the amount of panels, so all of them have to be bound again.
+        if (endIndex - firstIndex > m_recycledPanels.size())
+        {
+            while (m_recycledPanels.size() < endIndex - firstIndex)
+            {
+                auto panel = m_createItemFunc ? m_createItemFunc() : Panel::copy(m_panelTemplate);
+                panel->setSize(m_panelTemplate->getSize());
+                ScrollablePanel::add(panel);
+                m_recycledPanels.push_back({panel, std::numeric_limits<std::size_t>::max()});
+            }
+
+            rebindAll = true;
+        }
+
+        const Color& defaultColor = m_panelTemplate->getSharedRenderer()->getBackgroundColor();
+        for (std::size_t i = firstIndex; i < endIndex; ++i)
+        {
+            auto& recycledPanel = m_recycledPanels[i % m_recycledPanels.size()];
+            if ((recycledPanel.index == i) && !rebindAll)
+                continue;
+
+            recycledPanel.index = i;
+            recycledPanel.panel->setPosition(0, static_cast<float>(i) * itemHeight);
+            recycledPanel.panel->getRenderer()->setBackgroundColor(defaultColor);
+            recycledPanel.panel->setVisible(true);
+            if (m_bindItemFunc)
+                m_bindItemFunc(recycledPanel.panel, i);
+        }
+
+        // Hide the panels that aren't needed for the visible items
+        for (std::size_t i = 0; i < m_recycledPanels.size(); ++i)
+        {
+            auto& recycledPanel = m_recycledPanels[i];
+            if ((recycledPanel.index >= firstIndex) && (recycledPanel.index < endIndex) && (recycledPanel.index % m_recycledPanels.size() == i))
+                continue;
+
+            recycledPanel.index = std::numeric_limits<std::size_t>::max();
+            recycledPanel.panel->setVisible(false);
+        }
+
+        updateSelectedAndHoveringItemColorsAndStyle();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PanelListBox::connectVerticalScrollbar()
+    {
+        // The scrollbar is a copy when the list box was copied, or it still calls the original list box when it was moved
+        m_verticalScrollbar->onValueChange.disconnectAll();
+        m_verticalScrollbar->onValueChange([this]{ updateRecycledPanels(); });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PanelListBox::copyItemPanels(const PanelListBox& other)
+    {
+        // The child widgets were copied in the same order as the widgets in the original list box
+        const auto findCopiedPanel = [this,&other](const Panel::Ptr& panel) -> Panel::Ptr {
+            for (std::size_t i = 0; i < other.m_widgets.size(); ++i)
+            {
+                if (other.m_widgets[i] == panel)
+                    return std::dynamic_pointer_cast<Panel>(m_widgets[i]);
+            }
+
+            return nullptr;
+        };
+
+        for (auto& item : m_items)
+            item.panel = findCopiedPanel(item.panel);
+
+        for (auto& recycledPanel : m_recycledPanels)
+            recycledPanel.panel = findCopiedPanel(recycledPanel.panel);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -645,8 +967,8 @@ namespace tgui
         m_selectedItem = item;
         if (m_selectedItem >= 0)
         {
-            const auto& selectedItemObj = m_items[static_cast<std::size_t>(m_selectedItem)];
-            onItemSelect.emit(this, m_selectedItem, selectedItemObj.panel, selectedItemObj.id);
+            const auto selectedIndex = static_cast<std::size_t>(m_selectedItem);
+            onItemSelect.emit(this, m_selectedItem, getItemByIndex(selectedIndex), getIdByIndex(selectedIndex));
         }
 
         updateSelectedAndHoveringItemColorsAndStyle();
@@ -671,18 +993,22 @@ namespace tgui
 
     void PanelListBox::updateSelectedAndHoveringItemColorsAndStyle() const
     {
-        if (m_selectedItem >= 0 && m_selectedItemsBackgroundColorCached.isSet())
-            m_items[static_cast<std::size_t>(m_selectedItem)].panel->getRenderer()->setBackgroundColor(m_selectedItemsBackgroundColorCached);
+        // In recycling mode, the selected or hovered item might not have a panel
+        const auto selectedPanel = (m_selectedItem >= 0) ? getItemByIndex(static_cast<std::size_t>(m_selectedItem)) : nullptr;
+        const auto hoveringPanel = (m_hoveringItem >= 0) ? getItemByIndex(static_cast<std::size_t>(m_hoveringItem)) : nullptr;
+
+        if (selectedPanel && m_selectedItemsBackgroundColorCached.isSet())
+            selectedPanel->getRenderer()->setBackgroundColor(m_selectedItemsBackgroundColorCached);
         
-        if (m_hoveringItem >= 0)
+        if (hoveringPanel)
         {
             if (m_selectedItem == m_hoveringItem && m_selectedItemsBackgroundColorHoverCached.isSet())
             {
-                m_items[static_cast<std::size_t>(m_hoveringItem)].panel->getRenderer()->setBackgroundColor(m_selectedItemsBackgroundColorHoverCached);
+                hoveringPanel->getRenderer()->setBackgroundColor(m_selectedItemsBackgroundColorHoverCached);
             }
             else if (m_itemsBackgroundColorHoverCached.isSet())
             {
-                m_items[static_cast<std::size_t>(m_hoveringItem)].panel->getRenderer()->setBackgroundColor(m_itemsBackgroundColorHoverCached);
+                hoveringPanel->getRenderer()->setBackgroundColor(m_itemsBackgroundColorHoverCached);
             }
         }
     }
@@ -691,8 +1017,12 @@ namespace tgui
 
     void PanelListBox::clearItemStyle(const int item) const
     {
+        const auto panel = getItemByIndex(static_cast<std::size_t>(item));
+        if (!panel)
+            return;
+
         const auto& defaultColor = m_panelTemplate->getSharedRenderer()->getBackgroundColor();
-        m_items[static_cast<std::size_t>(item)].panel->getRenderer()->setBackgroundColor(defaultColor);
+        panel->getRenderer()->setBackgroundColor(defaultColor);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
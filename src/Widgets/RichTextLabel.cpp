@@ -76,15 +76,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void RichTextLabel::rendererChanged(const String& property)
+    void RichTextLabel::rendererPropertyChanged(RendererPropertyId property)
     {
-        if (property == U"TextColor")
+        switch (property)
         {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            rearrangeText();
+            case RendererPropertyId::TextColor:
+            {
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                rearrangeText();
+                break;
+            }
+            default:
+                Label::rendererPropertyChanged(property);
+                break;
         }
-        else
-            Label::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -87,10 +87,18 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void SeparatorLine::rendererChanged(const String& property)
+    void SeparatorLine::rendererPropertyChanged(RendererPropertyId property)
     {
-        if (property == U"Color")
-            m_colorCached = getSharedRenderer()->getColor();
+        switch (property)
+        {
+            case RendererPropertyId::Color:
+            {
+                m_colorCached = getSharedRenderer()->getColor();
+                break;
+            }
+            default:
+                break;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -45,11 +45,6 @@ namespace tgui
         Widget{typeName, false}
     {
         m_draggableWidget = true;
-        m_textBeforeSelection.setFont(m_fontCached);
-        m_textSelection1.setFont(m_fontCached);
-        m_textSelection2.setFont(m_fontCached);
-        m_textAfterSelection1.setFont(m_fontCached);
-        m_textAfterSelection2.setFont(m_fontCached);
         m_defaultText.setFont(m_fontCached);
 
         m_horizontalScrollbar->setSize(m_horizontalScrollbar->getSize().y, m_horizontalScrollbar->getSize().x);
@@ -219,11 +214,7 @@ namespace tgui
             m_textSizeCached = 1;
 
         // Change the text size
-        m_textBeforeSelection.setCharacterSize(m_textSizeCached);
-        m_textSelection1.setCharacterSize(m_textSizeCached);
-        m_textSelection2.setCharacterSize(m_textSizeCached);
-        m_textAfterSelection1.setCharacterSize(m_textSizeCached);
-        m_textAfterSelection2.setCharacterSize(m_textSizeCached);
+        m_lineTexts.clear();
         m_defaultText.setCharacterSize(m_textSizeCached);
 
         // Calculate the height of one line
@@ -419,6 +410,7 @@ namespace tgui
     void TextArea::setVerticalScrollbarValue(unsigned int value)
     {
         m_verticalScrollbar->setValue(value);
+        recalculateVisibleLines();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -533,6 +525,7 @@ namespace tgui
 
                 // If the next click comes soon enough then it will be a double click
                 m_possibleDoubleClick = true;
+                requestTimeUpdates();
             }
 
             // Update the texts
@@ -1264,6 +1257,7 @@ namespace tgui
         // Split the string in multiple lines
         m_maxLineWidth = 0;
         m_lines.clear();
+        m_lineTexts.clear();
         std::size_t searchPosStart = 0;
         std::size_t newLinePos = 0;
         std::size_t longestLineCharCount = 0;
@@ -1420,71 +1414,6 @@ namespace tgui
 
     void TextArea::updateSelectionTexts()
     {
-        // If there is no selection then just put the whole text in m_textBeforeSelection
-        if (m_selStart == m_selEnd)
-        {
-            String displayedText;
-            for (const auto& line : m_lines)
-                displayedText += line + U"\n";
-
-            m_textBeforeSelection.setString(displayedText);
-            m_textSelection1.setString(U"");
-            m_textSelection2.setString(U"");
-            m_textAfterSelection1.setString(U"");
-            m_textAfterSelection2.setString(U"");
-        }
-        else // Some text is selected
-        {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
-
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
-
-            // Set the text before the selection
-            if (selectionStart.y > 0)
-            {
-                String string;
-                for (std::size_t i = 0; i < selectionStart.y; ++i)
-                    string += m_lines[i] + U"\n";
-
-                string += m_lines[selectionStart.y].substr(0, selectionStart.x);
-                m_textBeforeSelection.setString(string);
-            }
-            else
-                m_textBeforeSelection.setString(m_lines[0].substr(0, selectionStart.x));
-
-            // Set the selected text
-            if (m_selStart.y == m_selEnd.y)
-            {
-                m_textSelection1.setString(m_lines[selectionStart.y].substr(selectionStart.x, selectionEnd.x - selectionStart.x));
-                m_textSelection2.setString(U"");
-            }
-            else
-            {
-                m_textSelection1.setString(m_lines[selectionStart.y].substr(selectionStart.x, m_lines[selectionStart.y].length() - selectionStart.x));
-
-                String string;
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
-                    string += m_lines[i] + U"\n";
-
-                string += m_lines[selectionEnd.y].substr(0, selectionEnd.x);
-
-                m_textSelection2.setString(string);
-            }
-
-            // Set the text after the selection
-            {
-                m_textAfterSelection1.setString(m_lines[selectionEnd.y].substr(selectionEnd.x, m_lines[selectionEnd.y].length() - selectionEnd.x));
-
-                String string;
-                for (std::size_t i = selectionEnd.y + 1; i < m_lines.size(); ++i)
-                    string += m_lines[i] + U"\n";
-
-                m_textAfterSelection2.setString(string);
-            }
-        }
-
         // Check if the caret is located above or below the view
         if (m_verticalScrollbarPolicy != Scrollbar::Policy::Never)
         {
@@ -1580,99 +1509,35 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextArea::recalculatePositions()
+    bool TextArea::isUpdateTimeRequired() const
     {
-        if (!m_fontCached)
-            return;
-
-        const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached);
-
-        // Calculate the position of the text objects
-        m_selectionRects.clear();
-        m_textBeforeSelection.setPosition({textOffset, 0});
-        m_defaultText.setPosition({ textOffset, 0 });
-
-        if (m_selStart != m_selEnd)
-        {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
-
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
-
-            float kerningSelectionStart = 0;
-            if ((selectionStart.x > 0) && (selectionStart.x < m_lines[selectionStart.y].length()))
-                kerningSelectionStart = m_fontCached.getKerning(m_lines[selectionStart.y][selectionStart.x-1], m_lines[selectionStart.y][selectionStart.x], m_textSizeCached, false);
-
-            float kerningSelectionEnd = 0;
-            if ((selectionEnd.x > 0) && (selectionEnd.x < m_lines[selectionEnd.y].length()))
-                kerningSelectionEnd = m_fontCached.getKerning(m_lines[selectionEnd.y][selectionEnd.x-1], m_lines[selectionEnd.y][selectionEnd.x], m_textSizeCached, false);
-
-            if (selectionStart.x > 0)
-            {
-                m_textSelection1.setPosition({textOffset + m_textBeforeSelection.findCharacterPos(m_textBeforeSelection.getString().length()).x + kerningSelectionStart,
-                                              m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
-            }
-            else
-                m_textSelection1.setPosition({textOffset, m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
-
-            m_textSelection2.setPosition({textOffset, static_cast<float>((selectionStart.y + 1) * m_lineHeight)});
-
-            if (!m_textSelection2.getString().empty() || (selectionEnd.x == 0))
-            {
-                m_textAfterSelection1.setPosition({textOffset + m_textSelection2.findCharacterPos(m_textSelection2.getString().length()).x + kerningSelectionEnd,
-                                                   m_textSelection2.getPosition().y + ((selectionEnd.y - selectionStart.y - 1) * m_lineHeight)});
-            }
-            else
-                m_textAfterSelection1.setPosition({m_textSelection1.getPosition().x + m_textSelection1.findCharacterPos(m_textSelection1.getString().length()).x + kerningSelectionEnd,
-                                                   m_textSelection1.getPosition().y});
-
-            m_textAfterSelection2.setPosition({textOffset, static_cast<float>(selectionEnd.y + 1) * m_lineHeight});
+        // The caret blinks while the widget is focused
+        return Widget::isUpdateTimeRequired() || m_focused || m_possibleDoubleClick;
+    }
 
-            // Recalculate the selection rectangles
-            {
-                m_selectionRects.emplace_back(m_textSelection1.getPosition().x, static_cast<float>(selectionStart.y) * m_lineHeight, 0.f, m_lineHeight);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                if (!m_lines[selectionStart.y].empty())
-                {
-                    m_selectionRects.back().width = m_textSelection1.findCharacterPos(m_textSelection1.getString().length()).x;
+    Duration TextArea::getTimeUntilNextUpdate() const
+    {
+        // Animations have to be updated every frame, the caret only has to be updated when it blinks
+        if (Widget::isUpdateTimeRequired())
+            return Widget::getTimeUntilNextUpdate();
 
-                    // There is kerning when the selection is on just this line
-                    if (selectionStart.y == selectionEnd.y)
-                        m_selectionRects.back().width += kerningSelectionEnd;
-                }
+        if (m_animationTimeElapsed >= getEditCursorBlinkRate())
+            return {};
 
-                /// TODO: Implement a way to calculate text size without creating a text object?
-                Text tempText;
-                tempText.setFont(m_fontCached);
-                tempText.setCharacterSize(getTextSize());
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
-                {
-                    m_selectionRects.back().width += textOffset;
-                    m_selectionRects.emplace_back(m_textSelection2.getPosition().x - textOffset, static_cast<float>(i) * m_lineHeight, textOffset, m_lineHeight);
+        return getEditCursorBlinkRate() - m_animationTimeElapsed;
+    }
 
-                    if (!m_lines[i].empty())
-                    {
-                        tempText.setString(m_lines[i]);
-                        m_selectionRects.back().width += tempText.findCharacterPos(tempText.getString().length()).x;
-                    }
-                }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                if (selectionStart.y != selectionEnd.y)
-                {
-                    m_selectionRects.back().width += textOffset;
+    void TextArea::recalculatePositions()
+    {
+        if (!m_fontCached)
+            return;
 
-                    if (m_textSelection2.getString() != U"")
-                    {
-                        tempText.setString(m_lines[selectionEnd.y].substr(0, selectionEnd.x));
-                        m_selectionRects.emplace_back(m_textSelection2.getPosition().x - textOffset, static_cast<float>(selectionEnd.y) * m_lineHeight,
-                                                      textOffset + tempText.findCharacterPos(tempText.getString().length()).x + kerningSelectionEnd, m_lineHeight);
-                    }
-                    else
-                        m_selectionRects.emplace_back(0.f, static_cast<float>(selectionEnd.y) * m_lineHeight, textOffset, m_lineHeight);
-                }
-            }
-        }
+        const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached);
+        m_defaultText.setPosition({textOffset, 0});
 
         recalculateVisibleLines();
     }
@@ -1710,6 +1575,147 @@ namespace tgui
             m_topLine = 0;
             m_visibleLines = std::min(static_cast<std::size_t>((getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - horiScrollOffset) / m_lineHeight), m_lines.size());
         }
+
+        updateLineTexts();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextArea::updateLineTexts()
+    {
+        if ((m_lineHeight == 0) || (m_fontCached == nullptr) || m_lines.empty())
+        {
+            m_lineTexts.clear();
+            return;
+        }
+
+        // When the visible lines aren't all available yet then the range of lines with text objects has to be moved.
+        // An extra page is kept above and below the view so that scrolling doesn't require new text objects every time.
+        const std::size_t visibleStart = std::min(m_topLine, m_lines.size() - 1);
+        const std::size_t visibleEnd = std::min(visibleStart + m_visibleLines + 1, m_lines.size());
+        if ((visibleStart < m_lineTextsStartLine) || (visibleEnd > m_lineTextsStartLine + m_lineTexts.size()))
+        {
+            const std::size_t margin = std::max<std::size_t>(m_visibleLines, 1);
+            const std::size_t newStart = (visibleStart > margin) ? (visibleStart - margin) : 0;
+            const std::size_t newEnd = std::min(visibleEnd + margin, m_lines.size());
+
+            // Lines that remain inside the range keep their text objects
+            if ((newEnd <= m_lineTextsStartLine) || (newStart >= m_lineTextsStartLine + m_lineTexts.size()))
+            {
+                m_lineTexts.clear();
+                m_lineTextsStartLine = newStart;
+            }
+
+            while (m_lineTextsStartLine < newStart)
+            {
+                m_lineTexts.pop_front();
+                ++m_lineTextsStartLine;
+            }
+
+            while (m_lineTextsStartLine + m_lineTexts.size() > newEnd)
+                m_lineTexts.pop_back();
+
+            while (m_lineTextsStartLine > newStart)
+            {
+                m_lineTexts.emplace_front();
+                --m_lineTextsStartLine;
+            }
+
+            while (m_lineTextsStartLine + m_lineTexts.size() < newEnd)
+                m_lineTexts.emplace_back();
+        }
+
+        auto selectionStart = m_selStart;
+        auto selectionEnd = m_selEnd;
+        if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
+            std::swap(selectionStart, selectionEnd);
+
+        const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached);
+        for (std::size_t i = 0; i < m_lineTexts.size(); ++i)
+        {
+            const std::size_t lineIndex = m_lineTextsStartLine + i;
+            const String& line = m_lines[lineIndex];
+
+            // Find out which part of the line is selected
+            LineSelection selection;
+            if ((selectionStart != selectionEnd) && (lineIndex >= selectionStart.y) && (lineIndex <= selectionEnd.y))
+            {
+                selection.start = (lineIndex == selectionStart.y) ? selectionStart.x : 0;
+                selection.end = (lineIndex == selectionEnd.y) ? selectionEnd.x : line.length();
+                selection.continuesAbove = (lineIndex > selectionStart.y);
+                selection.continuesBelow = (lineIndex < selectionEnd.y);
+            }
+            else
+            {
+                selection.start = line.length();
+                selection.end = line.length();
+            }
+
+            // Lines are only updated when they are new or when their selection changed
+            auto& lineTexts = m_lineTexts[i];
+            if (!lineTexts.needsUpdate
+             && (lineTexts.selection.start == selection.start)
+             && (lineTexts.selection.end == selection.end)
+             && (lineTexts.selection.continuesAbove == selection.continuesAbove)
+             && (lineTexts.selection.continuesBelow == selection.continuesBelow))
+            {
+                continue;
+            }
+
+            lineTexts.selection = selection;
+            lineTexts.needsUpdate = false;
+
+            for (Text* text : {&lineTexts.textBeforeSelection, &lineTexts.textSelection, &lineTexts.textAfterSelection})
+            {
+                text->setFont(m_fontCached);
+                text->setCharacterSize(m_textSizeCached);
+                text->setOpacity(m_opacityCached);
+            }
+
+            lineTexts.textBeforeSelection.setColor(m_textColorCached);
+            lineTexts.textSelection.setColor(m_selectedTextColorCached);
+            lineTexts.textAfterSelection.setColor(m_textColorCached);
+
+            lineTexts.textBeforeSelection.setString(line.substr(0, selection.start));
+            lineTexts.textSelection.setString(line.substr(selection.start, selection.end - selection.start));
+            lineTexts.textAfterSelection.setString(line.substr(selection.end));
+
+            float kerningSelectionStart = 0;
+            if ((selection.start > 0) && (selection.start < line.length()))
+                kerningSelectionStart = m_fontCached.getKerning(line[selection.start - 1], line[selection.start], m_textSizeCached, false);
+
+            float kerningSelectionEnd = 0;
+            if ((selection.end > 0) && (selection.end < line.length()))
+                kerningSelectionEnd = m_fontCached.getKerning(line[selection.end - 1], line[selection.end], m_textSizeCached, false);
+
+            const float lineTop = static_cast<float>(lineIndex) * m_lineHeight;
+            lineTexts.textBeforeSelection.setPosition({textOffset, lineTop});
+
+            float selectionLeft = textOffset;
+            if (selection.start > 0)
+                selectionLeft += lineTexts.textBeforeSelection.findCharacterPos(selection.start).x + kerningSelectionStart;
+            lineTexts.textSelection.setPosition({selectionLeft, lineTop});
+
+            float selectionWidth = 0;
+            if (selection.end > selection.start)
+                selectionWidth = lineTexts.textSelection.findCharacterPos(selection.end - selection.start).x;
+            lineTexts.textAfterSelection.setPosition({selectionLeft + selectionWidth + kerningSelectionEnd, lineTop});
+
+            // The selection background extends into the padding when the selection continues on another line
+            if ((selection.start != selection.end) || selection.continuesAbove || selection.continuesBelow)
+            {
+                lineTexts.selectionRect = {selectionLeft, lineTop, selectionWidth + kerningSelectionEnd, m_lineHeight};
+                if (selection.continuesAbove)
+                {
+                    lineTexts.selectionRect.left -= textOffset;
+                    lineTexts.selectionRect.width += textOffset;
+                }
+                if (selection.continuesBelow)
+                    lineTexts.selectionRect.width += textOffset;
+            }
+            else
+                lineTexts.selectionRect = {};
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1726,105 +1732,125 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextArea::rendererChanged(const String& property)
+    void TextArea::rendererPropertyChanged(RendererPropertyId property)
     {
-        if (property == U"Borders")
+        switch (property)
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == U"Padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == U"TextColor")
-        {
-            m_textBeforeSelection.setColor(getSharedRenderer()->getTextColor());
-            m_textAfterSelection1.setColor(getSharedRenderer()->getTextColor());
-            m_textAfterSelection2.setColor(getSharedRenderer()->getTextColor());
-        }
-        else if (property == U"SelectedTextColor")
-        {
-            m_textSelection1.setColor(getSharedRenderer()->getSelectedTextColor());
-            m_textSelection2.setColor(getSharedRenderer()->getSelectedTextColor());
-        }
-        else if (property == U"DefaultTextColor")
-        {
-            m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
-        }
-        else if (property == U"TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == U"Scrollbar")
-        {
-            m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
-            m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+            case RendererPropertyId::Borders:
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
+            }
+            case RendererPropertyId::Padding:
+            {
+                m_paddingCached = getSharedRenderer()->getPadding();
+                setSize(m_size);
+                break;
+            }
+            case RendererPropertyId::TextColor:
+            {
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                for (auto& lineTexts : m_lineTexts)
+                {
+                    lineTexts.textBeforeSelection.setColor(m_textColorCached);
+                    lineTexts.textAfterSelection.setColor(m_textColorCached);
+                }
+                break;
+            }
+            case RendererPropertyId::SelectedTextColor:
+            {
+                m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+                for (auto& lineTexts : m_lineTexts)
+                    lineTexts.textSelection.setColor(m_selectedTextColorCached);
+                break;
+            }
+            case RendererPropertyId::DefaultTextColor:
+            {
+                m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
+                break;
+            }
+            case RendererPropertyId::TextureBackground:
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+            }
+            case RendererPropertyId::Scrollbar:
+            {
+                m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+                m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
 
-            // If no scrollbar width was set then we may need to use the one from the texture
-            if (getSharedRenderer()->getScrollbarWidth() == 0)
+                // If no scrollbar width was set then we may need to use the one from the texture
+                if (getSharedRenderer()->getScrollbarWidth() == 0)
+                {
+                    m_verticalScrollbar->setSize({m_verticalScrollbar->getDefaultWidth(), m_verticalScrollbar->getSize().y});
+                    m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, m_horizontalScrollbar->getDefaultWidth()});
+                    setSize(m_size);
+                }
+                break;
+            }
+            case RendererPropertyId::ScrollbarWidth:
             {
-                m_verticalScrollbar->setSize({m_verticalScrollbar->getDefaultWidth(), m_verticalScrollbar->getSize().y});
-                m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, m_horizontalScrollbar->getDefaultWidth()});
+                const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
+                m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
+                m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
                 setSize(m_size);
+                break;
             }
-        }
-        else if (property == U"ScrollbarWidth")
-        {
-            const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
-            m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
-            m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
-            setSize(m_size);
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"SelectedTextBackgroundColor")
-        {
-            m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"CaretColor")
-        {
-            m_caretColorCached = getSharedRenderer()->getCaretColor();
-        }
-        else if (property == U"CaretWidth")
-        {
-            m_caretWidthCached = getSharedRenderer()->getCaretWidth();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
+            case RendererPropertyId::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+            case RendererPropertyId::SelectedTextBackgroundColor:
+            {
+                m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
+                break;
+            }
+            case RendererPropertyId::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+            case RendererPropertyId::CaretColor:
+            {
+                m_caretColorCached = getSharedRenderer()->getCaretColor();
+                break;
+            }
+            case RendererPropertyId::CaretWidth:
+            {
+                m_caretWidthCached = getSharedRenderer()->getCaretWidth();
+                break;
+            }
+            case RendererPropertyId::Opacity:
+            case RendererPropertyId::OpacityDisabled:
+            {
+                Widget::rendererPropertyChanged(property);
 
-            m_verticalScrollbar->setInheritedOpacity(m_opacityCached);
-            m_horizontalScrollbar->setInheritedOpacity(m_opacityCached);
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_textBeforeSelection.setOpacity(m_opacityCached);
-            m_textAfterSelection1.setOpacity(m_opacityCached);
-            m_textAfterSelection2.setOpacity(m_opacityCached);
-            m_textSelection1.setOpacity(m_opacityCached);
-            m_textSelection2.setOpacity(m_opacityCached);
-            m_defaultText.setOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
-        {
-            Widget::rendererChanged(property);
+                m_verticalScrollbar->setInheritedOpacity(m_opacityCached);
+                m_horizontalScrollbar->setInheritedOpacity(m_opacityCached);
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_defaultText.setOpacity(m_opacityCached);
+                for (auto& lineTexts : m_lineTexts)
+                {
+                    lineTexts.textBeforeSelection.setOpacity(m_opacityCached);
+                    lineTexts.textSelection.setOpacity(m_opacityCached);
+                    lineTexts.textAfterSelection.setOpacity(m_opacityCached);
+                }
+                break;
+            }
+            case RendererPropertyId::Font:
+            {
+                Widget::rendererPropertyChanged(property);
 
-            m_textBeforeSelection.setFont(m_fontCached);
-            m_textSelection1.setFont(m_fontCached);
-            m_textSelection2.setFont(m_fontCached);
-            m_textAfterSelection1.setFont(m_fontCached);
-            m_textAfterSelection2.setFont(m_fontCached);
-            m_defaultText.setFont(m_fontCached);
-            setTextSize(getTextSize());
+                m_defaultText.setFont(m_fontCached);
+                setTextSize(getTextSize());
+                break;
+            }
+            default:
+                Widget::rendererPropertyChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1936,9 +1962,26 @@ namespace tgui
             // Move the text according to the scrollars
             states.transform.translate({-static_cast<float>(m_horizontalScrollbar->getValue()), -static_cast<float>(m_verticalScrollbar->getValue())});
 
+            // Only the lines inside the clipping area have to be drawn
+            std::size_t firstLineText = 0;
+            std::size_t endLineText = 0;
+            if (m_lineHeight > 0)
+            {
+                const auto firstVisibleLine = static_cast<std::size_t>(static_cast<float>(m_verticalScrollbar->getValue()) / m_lineHeight);
+                const auto endVisibleLine = static_cast<std::size_t>((static_cast<float>(m_verticalScrollbar->getValue()) + clipHeight) / m_lineHeight) + 1;
+                if (firstVisibleLine > m_lineTextsStartLine)
+                    firstLineText = std::min(firstVisibleLine - m_lineTextsStartLine, m_lineTexts.size());
+                if (endVisibleLine > m_lineTextsStartLine)
+                    endLineText = std::min(endVisibleLine - m_lineTextsStartLine, m_lineTexts.size());
+            }
+
             // Draw the background of the selected text
-            for (const auto& selectionRect : m_selectionRects)
+            for (std::size_t i = firstLineText; i < endLineText; ++i)
             {
+                const FloatRect& selectionRect = m_lineTexts[i].selectionRect;
+                if (selectionRect.width <= 0)
+                    continue;
+
                 states.transform.translate({selectionRect.left, selectionRect.top});
                 target.drawFilledRect(states, {selectionRect.width, selectionRect.height + (std::max(m_fontCached.getFontHeight(m_textSizeCached), m_lineHeight) - m_lineHeight)},
                                       Color::applyOpacity(m_selectedTextBackgroundColorCached, m_opacityCached));
@@ -1950,13 +1993,15 @@ namespace tgui
                 target.drawText(states, m_defaultText);
             else
             {
-                target.drawText(states, m_textBeforeSelection);
-                if (m_selStart != m_selEnd)
+                for (std::size_t i = firstLineText; i < endLineText; ++i)
                 {
-                    target.drawText(states, m_textSelection1);
-                    target.drawText(states, m_textSelection2);
-                    target.drawText(states, m_textAfterSelection1);
-                    target.drawText(states, m_textAfterSelection2);
+                    const auto& lineTexts = m_lineTexts[i];
+                    if (!lineTexts.textBeforeSelection.getString().empty())
+                        target.drawText(states, lineTexts.textBeforeSelection);
+                    if (!lineTexts.textSelection.getString().empty())
+                        target.drawText(states, lineTexts.textSelection);
+                    if (!lineTexts.textAfterSelection.getString().empty())
+                        target.drawText(states, lineTexts.textAfterSelection);
                 }
             }
 
@@ -0,0 +1,112 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// These tests replace the global allocation functions, so they are built as a separate executable (tests-allocations)
+// to keep the replacement away from all other tests.
+
+#include "Tests.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    std::atomic<bool> countAllocations{false};
+    std::atomic<std::size_t> allocationCount{0};
+}
+
+// Replace the global allocation functions so that the tests can verify that emitting a signal doesn't allocate
+void* operator new(std::size_t size)
+{
+    if (countAllocations)
+        ++allocationCount;
+
+    if (void* ptr = std::malloc(size > 0 ? size : 1))
+        return ptr;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+TEST_CASE("[Signal] allocations")
+{
+    tgui::Widget::Ptr widget = tgui::ClickableWidget::create();
+
+    SECTION("No allocations during emit")
+    {
+        tgui::Vector2f lastPos;
+        unsigned int count = 0;
+        widget->onPositionChange([&]{ ++count; });
+        widget->onPositionChange([&](tgui::Vector2f pos){ lastPos = pos; });
+        widget->onPositionChange.connectEx([&](const tgui::Widget::Ptr&, const tgui::String&){ ++count; });
+
+        allocationCount = 0;
+        countAllocations = true;
+        for (unsigned int i = 0; i < 100; ++i)
+            widget->onPositionChange.emit(widget.get(), {static_cast<float>(i), 0});
+        countAllocations = false;
+
+        REQUIRE(allocationCount == 0);
+        REQUIRE(count == 200);
+        REQUIRE(lastPos == tgui::Vector2f{99, 0});
+    }
+}
+
+TEST_CASE("[Signal] emit benchmark", "[.][Benchmark]")
+{
+    tgui::Widget::Ptr widget = tgui::ClickableWidget::create();
+
+    unsigned int count = 0;
+    widget->onSizeChange([&]{ ++count; });
+    widget->onSizeChange([&](tgui::Vector2f size){ count += static_cast<unsigned int>(size.x); });
+    widget->onSizeChange([&]{ ++count; });
+    widget->onSizeChange([&]{ ++count; });
+
+    constexpr unsigned int emitCount = 1000000;
+    allocationCount = 0;
+    countAllocations = true;
+    const auto startTime = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < emitCount; ++i)
+        widget->onSizeChange.emit(widget.get(), {1, 1});
+    const auto endTime = std::chrono::steady_clock::now();
+    countAllocations = false;
+
+    REQUIRE(count == 4 * emitCount);
+    REQUIRE(allocationCount == 0);
+
+    const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+    WARN(emitCount << " emits with 4 handlers took " << (nanoseconds / 1000000) << "ms ("
+         << (static_cast<double>(nanoseconds) / emitCount) << "ns per emit, " << allocationCount << " allocations)");
+}
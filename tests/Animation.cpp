@@ -258,6 +258,37 @@ TEST_CASE("[Animation]")
             REQUIRE(!widget->isAnimationPlaying());
         }
 
+        SECTION("Gui only updates active widgets")
+        {
+            globalGui->add(parent);
+            globalGui->setUpdateOnlyActiveWidgets(true);
+            REQUIRE(globalGui->getUpdateOnlyActiveWidgets());
+            REQUIRE(!widget->isUpdateTimeRequired());
+
+            widget->moveWithAnimation({230, 25}, 300);
+            REQUIRE(widget->isUpdateTimeRequired());
+            globalGui->updateTime(std::chrono::milliseconds(150));
+            REQUIRE(widget->getPosition() == tgui::Vector2f{130, 20});
+
+            // Widgets aren't updated while their parent is hidden
+            parent->setVisible(false);
+            globalGui->updateTime(std::chrono::milliseconds(100));
+            REQUIRE(widget->getPosition() == tgui::Vector2f{130, 20});
+
+            parent->setVisible(true);
+            globalGui->updateTime(std::chrono::milliseconds(150));
+            REQUIRE(widget->getPosition() == tgui::Vector2f{230, 25});
+            REQUIRE(!widget->isUpdateTimeRequired());
+
+            // Active widgets can be removed from the gui
+            widget->moveWithAnimation({30, 15}, 300);
+            parent->remove(widget);
+            REQUIRE_NOTHROW(globalGui->updateTime(std::chrono::milliseconds(150)));
+
+            globalGui->setUpdateOnlyActiveWidgets(false);
+            globalGui->removeAllWidgets();
+        }
+
         // TODO: Add tests for simultaneous animations (tests for both same type and different types)
     }
 }
@@ -1346,4 +1346,82 @@ TEST_CASE("[Backend events]")
         }
     }
 #endif
+
+    SECTION("Mouse move coalescing")
+    {
+        auto button = tgui::Button::create();
+        button->setPosition({50, 50});
+        button->setSize({100, 50});
+        globalGui->add(button);
+
+        unsigned int mouseEnterCount = 0;
+        unsigned int mouseLeaveCount = 0;
+        button->onMouseEnter([&]{ ++mouseEnterCount; });
+        button->onMouseLeave([&]{ ++mouseLeaveCount; });
+
+        const auto createMouseMoveEvent = [](int x, int y){
+            tgui::Event event;
+            event.type = tgui::Event::Type::MouseMoved;
+            event.mouseMove.x = x;
+            event.mouseMove.y = y;
+            return event;
+        };
+
+        REQUIRE(!globalGui->getMouseMoveCoalescing());
+        REQUIRE(!globalGui->getMouseMoveHistoryEnabled());
+        globalGui->setMouseMoveCoalescing(true);
+        globalGui->setMouseMoveHistoryEnabled(true);
+        REQUIRE(globalGui->getMouseMoveCoalescing());
+        REQUIRE(globalGui->getMouseMoveHistoryEnabled());
+
+        // Mouse move events are only stored until they are processed
+        REQUIRE(!globalGui->handleEvent(createMouseMoveEvent(60, 60)));
+        REQUIRE(!globalGui->handleEvent(createMouseMoveEvent(70, 65)));
+        REQUIRE(!globalGui->handleEvent(createMouseMoveEvent(80, 70)));
+        REQUIRE(mouseEnterCount == 0);
+        REQUIRE(globalGui->getMouseMoveHistory().empty());
+
+        REQUIRE(globalGui->processPendingMouseMove());
+        REQUIRE(mouseEnterCount == 1);
+        REQUIRE(globalGui->getMouseMoveHistory().size() == 3);
+        REQUIRE(globalGui->getMouseMoveHistory()[0] == globalGui->mapPixelToCoords({60, 60}));
+        REQUIRE(globalGui->getMouseMoveHistory()[2] == globalGui->mapPixelToCoords({80, 70}));
+        REQUIRE(!globalGui->processPendingMouseMove());
+
+        // Moving outside the widget and back within the same frame doesn't trigger any events
+        globalGui->handleEvent(createMouseMoveEvent(300, 300));
+        globalGui->handleEvent(createMouseMoveEvent(90, 80));
+        REQUIRE(globalGui->processPendingMouseMove());
+        REQUIRE(mouseEnterCount == 1);
+        REQUIRE(mouseLeaveCount == 0);
+
+        // The pending mouse move is processed before other events
+        globalGui->handleEvent(createMouseMoveEvent(300, 300));
+        REQUIRE(mouseLeaveCount == 0);
+        tgui::Event event;
+        event.type = tgui::Event::Type::LostFocus;
+        globalGui->handleEvent(event);
+        REQUIRE(mouseLeaveCount == 1);
+        event.type = tgui::Event::Type::GainedFocus;
+        globalGui->handleEvent(event);
+
+        // Updating the time also processes the pending mouse move
+        globalGui->handleEvent(createMouseMoveEvent(60, 60));
+        REQUIRE(globalGui->updateTime(tgui::Duration{}));
+        REQUIRE(mouseEnterCount == 2);
+
+        // Disabling the coalescing processes the mouse moves immediately again
+        globalGui->handleEvent(createMouseMoveEvent(300, 300));
+        globalGui->setMouseMoveCoalescing(false);
+        REQUIRE(mouseLeaveCount == 2);
+        REQUIRE(globalGui->handleEvent(createMouseMoveEvent(60, 60)));
+        REQUIRE(mouseEnterCount == 3);
+        REQUIRE(globalGui->getMouseMoveHistory().size() == 1);
+
+        globalGui->setMouseMoveHistoryEnabled(false);
+        REQUIRE(globalGui->getMouseMoveHistory().empty());
+
+        globalGui->handleEvent(createMouseMoveEvent(300, 300));
+        globalGui->removeAllWidgets();
+    }
 }
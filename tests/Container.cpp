@@ -161,6 +161,62 @@ TEST_CASE("[Container]")
             child1->remove(child4);
             REQUIRE(container->get("name") == nullptr);
         }
+
+        SECTION("Changes after lookup")
+        {
+            // Names are looked up in an index, which has to be kept up-to-date when widgets change after a lookup
+            REQUIRE(container->get("w4") == widget4);
+            widget4->setWidgetName("w44");
+            REQUIRE(container->get("w4") == nullptr);
+            REQUIRE(container->get("w44") == widget4);
+            REQUIRE(widget2->get("w44") == widget4);
+
+            auto widget6 = tgui::Label::create();
+            widget2->add(widget6, "w6");
+            REQUIRE(container->get("w6") == widget6);
+            widget2->remove(widget6);
+            REQUIRE(container->get("w6") == nullptr);
+            REQUIRE(widget2->get("w6") == nullptr);
+
+            // Widgets inside a SubwidgetContainer are also found after they are changed
+            auto spinControl = tgui::SpinControl::create();
+            widget2->add(spinControl);
+            REQUIRE(container->get("w7") == nullptr);
+            auto widget7 = tgui::Label::create();
+            spinControl->getContainer()->add(widget7, "w7");
+            REQUIRE(container->get("w7") == widget7);
+            widget7->setWidgetName("w77");
+            REQUIRE(container->get("w7") == nullptr);
+            REQUIRE(container->get("w77") == widget7);
+
+            // Removing a container removes the widgets inside it from the index
+            container->remove(widget2);
+            REQUIRE(container->get("w44") == nullptr);
+            REQUIRE(container->get("w77") == nullptr);
+            REQUIRE(widget2->get("w77") == widget7);
+
+            // The index doesn't keep removed widgets alive
+            auto widget8 = tgui::Label::create();
+            std::weak_ptr<tgui::Widget> weakWidget8 = widget8;
+            container->add(widget8, "w8");
+            REQUIRE(container->get("w8") == widget8);
+            container->remove(widget8);
+            widget8 = nullptr;
+            REQUIRE(weakWidget8.expired());
+            REQUIRE(container->get("w8") == nullptr);
+
+            // Renaming one of the widgets that share a name keeps the other one findable
+            auto widget9 = tgui::Label::create();
+            auto widget10 = tgui::Label::create();
+            container->add(widget9, "w9");
+            container->add(widget10, "w9");
+            REQUIRE(container->get("w9") == widget9);
+            widget10->moveToBack();
+            REQUIRE(container->get("w9") == widget10);
+            widget10->setWidgetName("w10");
+            REQUIRE(container->get("w9") == widget9);
+            REQUIRE(container->get("w10") == widget10);
+        }
     }
 
     SECTION("remove")
@@ -437,6 +493,89 @@ TEST_CASE("[Container]")
         REQUIRE(container->getWidgetBelowMouseCursor({93, 39}) == w3);
     }
 
+    SECTION("Spatial index")
+    {
+        auto panel = tgui::Panel::create({500, 500});
+        REQUIRE(!panel->isSpatialIndexEnabled());
+        panel->setSpatialIndexEnabled(true);
+        REQUIRE(panel->isSpatialIndexEnabled());
+        REQUIRE(panel->getSpatialIndexCellSize() == 64);
+        panel->setSpatialIndexCellSize(32);
+        REQUIRE(panel->getSpatialIndexCellSize() == 32);
+
+        std::vector<tgui::ClickableWidget::Ptr> widgets;
+        for (unsigned int y = 0; y < 40; ++y)
+        {
+            for (unsigned int x = 0; x < 40; ++x)
+            {
+                auto widget = tgui::ClickableWidget::create({10, 10});
+                widget->setPosition({x * 12.f, y * 12.f});
+                panel->add(widget);
+                widgets.push_back(widget);
+            }
+        }
+
+        REQUIRE(panel->getWidgetAtPosition({5, 5}) == widgets[0]);
+        REQUIRE(panel->getWidgetAtPosition({11, 5}) == nullptr);
+        REQUIRE(panel->getWidgetAtPosition({13, 13}) == widgets[41]);
+        REQUIRE(panel->getWidgetAtPosition({470, 470}) == widgets[1599]);
+
+        // Moving or resizing a widget updates the index
+        widgets[41]->setPosition({300, 2});
+        REQUIRE(panel->getWidgetAtPosition({13, 13}) == nullptr);
+        REQUIRE(panel->getWidgetAtPosition({301, 3}) == widgets[41]);
+        widgets[41]->setSize({30, 30});
+        REQUIRE(panel->getWidgetAtPosition({323, 23}) == widgets[41]);
+
+        // The widget in front is found when widgets overlap
+        REQUIRE(panel->getWidgetAtPosition({325, 13}) == widgets[67]);
+        panel->moveWidgetToFront(widgets[41]);
+        REQUIRE(panel->getWidgetAtPosition({325, 13}) == widgets[41]);
+        panel->moveWidgetToBack(widgets[41]);
+        REQUIRE(panel->getWidgetAtPosition({325, 13}) == widgets[67]);
+        panel->moveWidgetToFront(widgets[41]);
+        REQUIRE(panel->getWidgetAtPosition({325, 13}) == widgets[41]);
+
+        // Large widgets and widgets with a hit area outside their size are also found
+        auto background = tgui::ClickableWidget::create({500, 500});
+        panel->add(background);
+        panel->moveWidgetToBack(background);
+        REQUIRE(panel->getWidgetAtPosition({11, 5}) == background);
+
+        auto radioButton = tgui::RadioButton::create();
+        radioButton->setText("Radio button with a long text");
+        radioButton->setPosition({100, 100});
+        radioButton->setSize({10, 10});
+        panel->add(radioButton);
+        REQUIRE(panel->getWidgetAtPosition({200, 105}) == radioButton);
+
+        // Rotated widgets are stored based on their bounding box
+        widgets[1599]->setRotation(45, {0.5f, 0.5f});
+        REQUIRE(panel->getWidgetAtPosition({475, 475}) == widgets[1599]);
+        REQUIRE(panel->getWidgetAtPosition({466.5f, 473}) == widgets[1599]);
+
+        panel->remove(widgets[1599]);
+        REQUIRE(panel->getWidgetAtPosition({475, 475}) == background);
+
+        // The results are identical to those without an index
+        auto panelWithoutIndex = tgui::Panel::copy(panel);
+        REQUIRE(panelWithoutIndex->isSpatialIndexEnabled());
+        panelWithoutIndex->setSpatialIndexEnabled(false);
+        for (float y = 0; y < 500; y += 7)
+        {
+            for (float x = 0; x < 500; x += 7)
+            {
+                const auto widget = panel->getWidgetAtPosition({x, y});
+                const auto widgetWithoutIndex = panelWithoutIndex->getWidgetAtPosition({x, y});
+                REQUIRE(widget != nullptr);
+                REQUIRE(panel->getWidgetIndex(widget) == panelWithoutIndex->getWidgetIndex(widgetWithoutIndex));
+            }
+        }
+
+        panel->removeAllWidgets();
+        REQUIRE(panel->getWidgetAtPosition({5, 5}) == nullptr);
+    }
+
     // TODO: Events
     //       Test parameter of Widget::disable
 }
@@ -75,4 +75,19 @@ TEST_CASE("[Filesystem]")
         REQUIRE(tgui::Filesystem::createDirectory("filesystem-test-dir"));
         REQUIRE(tgui::Filesystem::directoryExists("filesystem-test-dir"));
     }
+
+    SECTION("File info")
+    {
+        tgui::Filesystem::FileInfo fileInfo;
+        REQUIRE(tgui::Filesystem::getFileInfo(tgui::Filesystem::Path("resources/image.png"), fileInfo));
+        REQUIRE(fileInfo.filename == "image.png");
+        REQUIRE(!fileInfo.directory);
+        REQUIRE(fileInfo.fileSize > 0);
+        REQUIRE(fileInfo.modificationTime > 0);
+
+        REQUIRE(tgui::Filesystem::getFileInfo(tgui::Filesystem::Path("resources"), fileInfo));
+        REQUIRE(fileInfo.directory);
+
+        REQUIRE(!tgui::Filesystem::getFileInfo(tgui::Filesystem::Path("resources/NonExistentFile.png"), fileInfo));
+    }
 }
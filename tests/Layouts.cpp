@@ -338,12 +338,14 @@ TEST_CASE("[Layouts]")
             REQUIRE(Layout("min(5 + min(2, 3), max(2, 1) * 3)").getValue() == 6);
             REQUIRE(Layout("min(5 + min(2, 3), max(2, 1) * 4)").getValue() == 7);
             REQUIRE(Layout("6 * (max(2,1) + (1 - (5))) / (-3)").getValue() == 4);
+            REQUIRE(Layout("1 + 2 * 3 - 4 / 2 + 5 * 2 * 3 - 6").getValue() == 29);
 
             REQUIRE(Layout("5 + 3 * 2 - 1").toString() == "(5 + (3 * 2)) - 1");
             REQUIRE(Layout("5 + 3 * (2 - 1)").toString() == "5 + (3 * (2 - 1))");
             REQUIRE(Layout("(5 + 3) * 2 - 1").toString() == "((5 + 3) * 2) - 1");
             REQUIRE(Layout("min(5 + min(2, 3), max(2, 1) * 3)").toString() == "min(5 + min(2, 3), max(2, 1) * 3)");
             REQUIRE(Layout("6 * (max(2,1) + (1 - (5))) / (-3)").toString() == "(6 * (max(2, 1) + (1 - 5))) / -3");
+            REQUIRE(Layout("1 + 2 * 3 - 4 / 2 + 5 * 2 * 3 - 6").toString() == "(((1 + (2 * 3)) - (4 / 2)) + ((5 * 2) * 3)) - 6");
 
             REQUIRE(Layout("(5 + 3) * 2 - 1").toString() == "((5 + 3) * 2) - 1");
 
@@ -448,6 +450,111 @@ TEST_CASE("[Layouts]")
             widget->setPosition({"0"},{"0"});
             widget->setPosition("0","0");
         }
+
+        SECTION("Compiled expressions")
+        {
+            auto panel = tgui::Panel::create({200, 100});
+            auto button = tgui::Button::create();
+            panel->add(button);
+
+            // Constant parts of the expression are calculated once, but the expression can still be converted back to a string
+            button->setSize({"parent.width - 2 * (10 + 5)"}, {"max(parent.height / 4, 10 * 2)"});
+            REQUIRE(button->getSize() == tgui::Vector2f(170, 25));
+            REQUIRE(button->getSizeLayout().toString() == "(parent.width - (2 * (10 + 5)), max(parent.height / 4, 10 * 2))");
+
+            panel->setSize({300, 40});
+            REQUIRE(button->getSize() == tgui::Vector2f(270, 20));
+            REQUIRE(button->getSizeLayout().x.getLeftOperand()->getValue() == 300);
+            REQUIRE(button->getSizeLayout().x.getRightOperand()->getValue() == 30);
+            REQUIRE(button->getSizeLayout().y.getLeftOperand()->getValue() == 10);
+
+            // Replacing an operand changes the result
+            button->getSizeLayout().x.getRightOperand()->replaceValue(Layout{20});
+            REQUIRE(button->getSize() == tgui::Vector2f(280, 20));
+            panel->setSize({400, 60});
+            REQUIRE(button->getSize() == tgui::Vector2f(380, 20));
+
+            // Expressions that need a large stack to be calculated
+            tgui::String expression = "parent.width";
+            for (unsigned int i = 0; i < 20; ++i)
+                expression = tgui::String{"1 + ("} + expression + ")";
+            button->setSize({expression, 10});
+            REQUIRE(button->getSize() == tgui::Vector2f(420, 10));
+            panel->setSize({100, 60});
+            REQUIRE(button->getSize() == tgui::Vector2f(120, 10));
+        }
+    }
+
+    SECTION("Batch update")
+    {
+        auto panel = tgui::Panel::create({400, 300});
+        auto widget1 = tgui::ClickableWidget::create();
+        auto widget2 = tgui::ClickableWidget::create();
+        auto widget3 = tgui::ClickableWidget::create();
+        panel->add(widget1);
+        panel->add(widget2);
+        panel->add(widget3);
+
+        widget1->setSize({"&.w / 2", 20});
+        widget2->setSize({bindWidth(widget1) + 10, 20});
+        widget3->setSize({bindWidth(widget1) + bindWidth(widget2), 20});
+        REQUIRE(widget3->getSize() == tgui::Vector2f(410, 20));
+
+        unsigned int sizeChangeCount = 0;
+        widget3->onSizeChange([&]{ ++sizeChangeCount; });
+
+        // Without a batch update, the last widget is updated once for each widget that it depends on
+        panel->setSize({600, 300});
+        REQUIRE(widget3->getSize() == tgui::Vector2f(610, 20));
+        REQUIRE(sizeChangeCount == 2);
+
+        sizeChangeCount = 0;
+        tgui::Layout::beginBatchUpdate();
+        tgui::Layout::beginBatchUpdate();
+        panel->setSize({800, 300});
+        tgui::Layout::endBatchUpdate();
+        REQUIRE(widget3->getSize() == tgui::Vector2f(610, 20));
+        REQUIRE(sizeChangeCount == 0);
+        tgui::Layout::endBatchUpdate();
+
+        REQUIRE(widget1->getSize() == tgui::Vector2f(400, 20));
+        REQUIRE(widget2->getSize() == tgui::Vector2f(410, 20));
+        REQUIRE(widget3->getSize() == tgui::Vector2f(810, 20));
+        REQUIRE(sizeChangeCount == 1);
+
+        // A widget of which both the width and height changed is only resized once
+        class SizeCountingWidget : public tgui::ClickableWidget
+        {
+        public:
+            unsigned int setSizeCount = 0;
+
+            using ClickableWidget::setSize;
+            void setSize(const tgui::Layout2d& size) override
+            {
+                ++setSizeCount;
+                ClickableWidget::setSize(size);
+            }
+        };
+
+        auto widget4 = std::make_shared<SizeCountingWidget>();
+        panel->add(widget4);
+        widget4->setSize({"&.w / 4", "&.h / 4"});
+        REQUIRE(widget4->getSize() == tgui::Vector2f(200, 75));
+
+        widget4->setSizeCount = 0;
+        tgui::Layout::beginBatchUpdate();
+        panel->setSize({600, 200});
+        tgui::Layout::endBatchUpdate();
+        REQUIRE(widget4->getSize() == tgui::Vector2f(150, 50));
+        REQUIRE(widget4->setSizeCount == 1);
+
+        // Widgets that are destroyed before the batch update ends are no longer updated
+        tgui::Layout::beginBatchUpdate();
+        panel->setSize({400, 300});
+        panel->remove(widget3);
+        widget3 = nullptr;
+        tgui::Layout::endBatchUpdate();
+        REQUIRE(widget2->getSize() == tgui::Vector2f(210, 20));
     }
 
     SECTION("Bug Fixes")
@@ -0,0 +1,188 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+
+#if !TGUI_BUILD_AS_CXX_MODULE
+    #include <TGUI/TextureManager.hpp>
+#endif
+
+#include <thread>
+
+TEST_CASE("[MainLoop]")
+{
+    const unsigned int oldFrameRateLimit = globalGui->getFrameRateLimit();
+    globalGui->setFrameRateLimit(50);
+
+    // Start without widgets, timers, pending mouse moves or tool tips that may have been left behind by other tests
+    globalGui->removeAllWidgets();
+    tgui::Timer::clearTimers();
+    globalGui->updateTime(tgui::ToolTip::getInitialDelay());
+    REQUIRE(tgui::TextureManager::getAsyncLoadCount() == 0);
+
+    SECTION("Polling main loop")
+    {
+        globalGui->setEventDrivenMainLoop(false);
+
+        // Events are checked regularly, even when nothing has to be updated
+        const auto waitTime = globalGui->getMainLoopWaitTime();
+        REQUIRE(waitTime);
+        REQUIRE(*waitTime == std::chrono::milliseconds(10));
+
+        // The wait time is shorter when a timer has to be triggered sooner
+        tgui::Timer::scheduleCallback([]{}, std::chrono::milliseconds(4));
+        REQUIRE(*globalGui->getMainLoopWaitTime() == std::chrono::milliseconds(4));
+    }
+
+    SECTION("Event-driven main loop")
+    {
+        globalGui->setEventDrivenMainLoop(true);
+
+        // There is no need to wake up when nothing is going to happen
+        REQUIRE(!globalGui->getMainLoopWaitTime());
+
+        SECTION("Timers")
+        {
+            tgui::Timer::scheduleCallback([]{}, std::chrono::milliseconds(500));
+            REQUIRE(*globalGui->getMainLoopWaitTime() == std::chrono::milliseconds(500));
+
+            globalGui->updateTime(std::chrono::milliseconds(200));
+            REQUIRE(*globalGui->getMainLoopWaitTime() == std::chrono::milliseconds(300));
+
+            globalGui->updateTime(std::chrono::milliseconds(300));
+            REQUIRE(!globalGui->getMainLoopWaitTime());
+        }
+
+        SECTION("Active widgets")
+        {
+            auto parent = tgui::Panel::create();
+            auto widget = tgui::Panel::create();
+            parent->add(widget);
+            globalGui->add(parent);
+
+            // Widgets are updated every frame while they are playing an animation
+            widget->moveWithAnimation({100, 50}, std::chrono::milliseconds(300));
+            REQUIRE(*globalGui->getMainLoopWaitTime() == std::chrono::milliseconds(20));
+
+            // Hidden widgets aren't updated, so they don't have to wake up the main loop
+            parent->setVisible(false);
+            REQUIRE(!globalGui->getMainLoopWaitTime());
+            parent->setVisible(true);
+            REQUIRE(*globalGui->getMainLoopWaitTime() == std::chrono::milliseconds(20));
+
+            // Once the animation has finished, the widget no longer keeps the main loop awake
+            globalGui->updateTime(std::chrono::milliseconds(300));
+            REQUIRE(!globalGui->getMainLoopWaitTime());
+
+            // The same happens when the gui only updates active widgets
+            globalGui->setUpdateOnlyActiveWidgets(true);
+            widget->moveWithAnimation({0, 0}, std::chrono::milliseconds(300));
+            REQUIRE(*globalGui->getMainLoopWaitTime() == std::chrono::milliseconds(20));
+            globalGui->updateTime(std::chrono::milliseconds(300));
+            REQUIRE(!globalGui->getMainLoopWaitTime());
+            globalGui->setUpdateOnlyActiveWidgets(false);
+
+            // Removing a widget during its animation unregisters it
+            widget->moveWithAnimation({100, 50}, std::chrono::milliseconds(300));
+            parent->remove(widget);
+            REQUIRE(!globalGui->getMainLoopWaitTime());
+
+            globalGui->removeAllWidgets();
+        }
+
+        SECTION("Focused text fields")
+        {
+            auto editBox = tgui::EditBox::create();
+            globalGui->add(editBox);
+
+            // The main loop only has to wake up when the caret blinks
+            editBox->setFocused(true);
+            REQUIRE(*globalGui->getMainLoopWaitTime() == tgui::getEditCursorBlinkRate());
+
+            globalGui->updateTime(tgui::getEditCursorBlinkRate() / 2);
+            REQUIRE(*globalGui->getMainLoopWaitTime() == tgui::getEditCursorBlinkRate() - tgui::getEditCursorBlinkRate() / 2);
+
+            // An animation still requires updates every frame
+            editBox->moveWithAnimation({100, 50}, std::chrono::milliseconds(300));
+            REQUIRE(*globalGui->getMainLoopWaitTime() == std::chrono::milliseconds(20));
+            globalGui->updateTime(std::chrono::milliseconds(300));
+
+            auto textArea = tgui::TextArea::create();
+            globalGui->add(textArea);
+            textArea->setFocused(true);
+            REQUIRE(*globalGui->getMainLoopWaitTime() == tgui::getEditCursorBlinkRate());
+
+            textArea->setFocused(false);
+            REQUIRE(!globalGui->getMainLoopWaitTime());
+
+            globalGui->removeAllWidgets();
+        }
+
+        SECTION("Async loads")
+        {
+            tgui::TextureManager::removeUnusedTextures();
+
+            tgui::Texture texture;
+            texture.loadAsync("resources/image.jpg");
+            REQUIRE(texture.isLoading());
+
+            // The main loop has to wake up to upload the image once it has been decoded
+            REQUIRE(*globalGui->getMainLoopWaitTime() == std::chrono::milliseconds(20));
+
+            for (unsigned int i = 0; (i < 1000) && texture.isLoading(); ++i)
+            {
+                if (!globalGui->updateTime(std::chrono::milliseconds(1)))
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+
+            REQUIRE(!texture.isLoading());
+            REQUIRE(!globalGui->getMainLoopWaitTime());
+        }
+
+        SECTION("Tool tips")
+        {
+            tgui::Event event;
+            event.type = tgui::Event::Type::MouseMoved;
+            event.mouseMove.x = 10;
+            event.mouseMove.y = 10;
+            globalGui->handleEvent(event);
+            globalGui->processPendingMouseMove();
+
+            // After the mouse moved, the main loop has to wake up when a tool tip might have to be shown
+            REQUIRE(*globalGui->getMainLoopWaitTime() == tgui::ToolTip::getInitialDelay());
+
+            globalGui->updateTime(tgui::ToolTip::getInitialDelay() / 2);
+            REQUIRE(*globalGui->getMainLoopWaitTime() == tgui::ToolTip::getInitialDelay() - tgui::ToolTip::getInitialDelay() / 2);
+
+            globalGui->updateTime(tgui::ToolTip::getInitialDelay());
+            REQUIRE(!globalGui->getMainLoopWaitTime());
+        }
+
+        globalGui->setEventDrivenMainLoop(false);
+    }
+
+    tgui::Timer::clearTimers();
+    globalGui->setFrameRateLimit(oldFrameRateLimit);
+}
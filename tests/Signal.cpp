@@ -138,4 +138,51 @@ TEST_CASE("[Signal]")
         signal.emit(nullptr);
         REQUIRE(x == 5);
     }
+
+    SECTION("Changes during emit")
+    {
+        tgui::Signal signal{"Test"};
+        std::vector<int> calls;
+
+        unsigned int id2 = 0;
+        unsigned int id3 = 0;
+        const unsigned int id1 = signal.connect([&]{
+            calls.push_back(1);
+            signal.disconnect(id2);
+        });
+        id2 = signal.connect([&]{ calls.push_back(2); });
+        id3 = signal.connect([&]{
+            calls.push_back(3);
+            REQUIRE(signal.disconnect(id3));
+            REQUIRE_FALSE(signal.disconnect(id3));
+            signal.connect([&]{ calls.push_back(4); });
+        });
+
+        REQUIRE(signal.emit(nullptr));
+        REQUIRE(calls == std::vector<int>{1, 3});
+
+        calls.clear();
+        REQUIRE(signal.emit(nullptr));
+        REQUIRE(calls == std::vector<int>{1, 4});
+
+        calls.clear();
+        signal.connect([&]{
+            calls.push_back(5);
+            signal.disconnectAll();
+        });
+        signal.connect([&]{ calls.push_back(6); });
+        REQUIRE(signal.emit(nullptr));
+        REQUIRE(calls == std::vector<int>{1, 4, 5});
+        REQUIRE_FALSE(signal.emit(nullptr));
+        REQUIRE_FALSE(signal.disconnect(id1));
+
+        // The signal may be destroyed by one of its own handlers
+        auto signalPtr = std::make_unique<tgui::Signal>("Test");
+        unsigned int count = 0;
+        signalPtr->connect([&]{ signalPtr = nullptr; ++count; });
+        signalPtr->connect([&]{ ++count; });
+        signalPtr->emit(nullptr);
+        REQUIRE(count == 2);
+        REQUIRE(signalPtr == nullptr);
+    }
 }
@@ -28,6 +28,8 @@
     #include <TGUI/SvgImage.hpp>
 #endif
 
+#include <thread>
+
 TEST_CASE("[SvgImage]")
 {
     SECTION("Empty image")
@@ -54,6 +56,109 @@ TEST_CASE("[SvgImage]")
         REQUIRE(tgui::Vector2u{texture->getSize()} == tgui::Vector2u{100, 100});
     }
 
+    SECTION("Rasterization cache")
+    {
+        REQUIRE(tgui::SvgImage::getRasterizationCacheLimit() == 32);
+        const std::size_t initialCacheSize = tgui::SvgImage::getRasterizationCacheSize();
+
+        std::shared_ptr<tgui::BackendTexture> outlivingTexture;
+        {
+            tgui::SvgImage svgImage{"resources/SFML.svg"};
+
+            auto texture1 = svgImage.getRasterizedTexture({100, 100});
+            auto texture2 = svgImage.getRasterizedTexture({100, 100});
+            auto texture3 = svgImage.getRasterizedTexture({50, 50});
+            REQUIRE(texture1 == texture2);
+            REQUIRE(texture1 != texture3);
+            REQUIRE(texture1->getSize() == tgui::Vector2u{100, 100});
+            REQUIRE(texture3->getSize() == tgui::Vector2u{50, 50});
+            REQUIRE(tgui::SvgImage::getRasterizationCacheSize() == initialCacheSize + 2);
+
+            // Textures that are still in use are never removed
+            tgui::SvgImage::setRasterizationCacheLimit(0);
+            REQUIRE(tgui::SvgImage::getRasterizationCacheLimit() == 0);
+            REQUIRE(tgui::SvgImage::getRasterizationCacheSize() == initialCacheSize + 2);
+
+            // The least recently used textures are removed first
+            tgui::SvgImage::setRasterizationCacheLimit(1);
+            texture1 = nullptr;
+            texture2 = nullptr;
+            texture3 = nullptr;
+            auto texture4 = svgImage.getRasterizedTexture({70, 70});
+            REQUIRE(tgui::SvgImage::getRasterizationCacheSize() == initialCacheSize + 2);
+            texture3 = svgImage.getRasterizedTexture({50, 50});
+            REQUIRE(tgui::SvgImage::getRasterizationCacheSize() == initialCacheSize + 2);
+            tgui::SvgImage::setRasterizationCacheLimit(32);
+
+            outlivingTexture = texture4;
+        }
+
+        // Destroying the image removes its textures from the cache
+        REQUIRE(tgui::SvgImage::getRasterizationCacheSize() == initialCacheSize);
+
+        // Textures that are still used remain valid after the image is destroyed
+        REQUIRE(outlivingTexture->getSize() == tgui::Vector2u{70, 70});
+        outlivingTexture = nullptr;
+        REQUIRE(tgui::SvgImage::getRasterizationCacheSize() == initialCacheSize);
+
+        {
+            tgui::Texture texture{"resources/SFML.svg"};
+            tgui::Sprite sprite1{texture};
+            tgui::Sprite sprite2{texture};
+            sprite1.setSize({40, 40});
+            sprite2.setSize({40, 40});
+            REQUIRE(sprite1.getSvgTexture() == sprite2.getSvgTexture());
+
+            sprite2.setSize({60, 40});
+            REQUIRE(sprite1.getSvgTexture() != sprite2.getSvgTexture());
+            REQUIRE(sprite2.getSvgTexture()->getSize() == tgui::Vector2u{60, 40});
+        }
+    }
+
+    SECTION("Background rasterization")
+    {
+        REQUIRE(!tgui::SvgImage::getBackgroundRasterization());
+        tgui::SvgImage::setBackgroundRasterization(true);
+        REQUIRE(tgui::SvgImage::getBackgroundRasterization());
+
+        REQUIRE(tgui::SvgImage::getRasterizationBucketSize({10, 16}) == tgui::Vector2u{10, 16});
+        REQUIRE(tgui::SvgImage::getRasterizationBucketSize({17, 100}) == tgui::Vector2u{18, 104});
+        REQUIRE(tgui::SvgImage::getRasterizationBucketSize({130, 64}) == tgui::Vector2u{144, 64});
+
+        {
+            // The first texture is rasterized immediately
+            tgui::Texture texture{"resources/SFML.svg"};
+            tgui::Sprite sprite{texture};
+            REQUIRE(sprite.getSvgTexture()->getSize() == tgui::Vector2u{144, 144});
+            REQUIRE(tgui::SvgImage::getBackgroundRasterizationCount() == 0);
+
+            // The previous texture is used until the image has been rasterized at the new size
+            const auto oldTexture = sprite.getSvgTexture();
+            sprite.setSize({100, 100});
+            REQUIRE(sprite.getSvgTexture() == oldTexture);
+            REQUIRE(tgui::SvgImage::getBackgroundRasterizationCount() == 1);
+
+            const auto startTime = std::chrono::steady_clock::now();
+            while ((tgui::SvgImage::getBackgroundRasterizationCount() > 0) && (std::chrono::steady_clock::now() - startTime < std::chrono::seconds(10)))
+            {
+                tgui::SvgImage::processBackgroundRasterizations();
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+
+            REQUIRE(tgui::SvgImage::getBackgroundRasterizationCount() == 0);
+            REQUIRE(sprite.getSvgTexture() != oldTexture);
+            REQUIRE(sprite.getSvgTexture()->getSize() == tgui::Vector2u{104, 104});
+
+            // Sizes that fall in the same bucket reuse the texture
+            const auto newTexture = sprite.getSvgTexture();
+            sprite.setSize({98, 101});
+            REQUIRE(sprite.getSvgTexture() == newTexture);
+            REQUIRE(tgui::SvgImage::getBackgroundRasterizationCount() == 0);
+        }
+
+        tgui::SvgImage::setBackgroundRasterization(false);
+    }
+
     SECTION("Drawing svg")
     {
         auto picture = tgui::Picture::create("resources/SFML.svg");
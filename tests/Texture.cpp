@@ -33,6 +33,10 @@
     #include <TGUI/TextureManager.hpp>
 #endif
 
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
 #if TGUI_HAS_BACKEND_SFML_GRAPHICS
     #if TGUI_BUILD_AS_CXX_MODULE
         import tgui.backend.renderer.sfml_graphics;
@@ -128,6 +132,86 @@ TEST_CASE("[Texture]")
         }
     }
 
+    SECTION("loadAsync")
+    {
+        SECTION("Success")
+        {
+            unsigned int callbackCount = 0;
+            tgui::Texture texture1;
+            texture1.loadAsync("resources/image.png", [&](bool success){ REQUIRE(success); ++callbackCount; }, {10, 5, 40, 30});
+            REQUIRE(texture1.getId() == "resources/image.png");
+            REQUIRE(texture1.isLoading());
+            REQUIRE(texture1.getPartRect() == tgui::UIntRect(10, 5, 40, 30));
+            REQUIRE(texture1.getData()->backendTexture->getSize() == tgui::Vector2u(50, 50));
+
+            // The same image is only decoded once
+            tgui::Texture texture2;
+            texture2.loadAsync("resources/image.png", [&](bool success){ REQUIRE(success); ++callbackCount; });
+            REQUIRE(texture2.isLoading());
+            REQUIRE(texture2.getData() == texture1.getData());
+            REQUIRE(texture2.getImageSize() == tgui::Vector2u(50, 50));
+            REQUIRE(tgui::TextureManager::getAsyncLoadCount() == 1);
+
+            for (unsigned int i = 0; (i < 1000) && texture1.isLoading(); ++i)
+            {
+                if (!tgui::TextureManager::processAsyncLoads())
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+
+            REQUIRE(!texture1.isLoading());
+            REQUIRE(!texture2.isLoading());
+            REQUIRE(callbackCount == 2);
+            REQUIRE(tgui::TextureManager::getAsyncLoadCount() == 0);
+            REQUIRE(texture1.getData()->backendTexture->getPixels() != nullptr);
+
+            // The callback is called immediately when the image was already loaded
+            tgui::Texture texture3;
+            texture3.loadAsync("resources/image.png", [&](bool success){ REQUIRE(success); ++callbackCount; });
+            REQUIRE(!texture3.isLoading());
+            REQUIRE(callbackCount == 3);
+        }
+
+        SECTION("Failure")
+        {
+            tgui::Texture texture;
+            REQUIRE_THROWS_AS(texture.loadAsync("NonExistent.png"), tgui::Exception);
+            REQUIRE_THROWS_AS(texture.loadAsync("resources/ThemeButton1.txt"), tgui::Exception);
+            REQUIRE(!texture.isLoading());
+        }
+
+        SECTION("Upload budget")
+        {
+            REQUIRE(tgui::TextureManager::getAsyncUploadBudget() == 4 * 1024 * 1024);
+            tgui::TextureManager::setAsyncUploadBudget(1);
+
+            tgui::Texture texture1;
+            tgui::Texture texture2;
+            texture1.loadAsync("resources/image.png");
+            texture2.loadAsync("resources/image.jpg");
+            REQUIRE(tgui::TextureManager::getAsyncLoadCount() == 2);
+
+            // Only one image is uploaded per call when the budget is too small
+            for (unsigned int i = 0; (i < 1000) && (tgui::TextureManager::getAsyncLoadCount() == 2); ++i)
+            {
+                if (!tgui::TextureManager::processAsyncLoads())
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+
+            REQUIRE(tgui::TextureManager::getAsyncLoadCount() == 1);
+            REQUIRE(texture1.isLoading() != texture2.isLoading());
+
+            for (unsigned int i = 0; (i < 1000) && (tgui::TextureManager::getAsyncLoadCount() > 0); ++i)
+            {
+                if (!tgui::TextureManager::processAsyncLoads())
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+
+            REQUIRE(!texture1.isLoading());
+            REQUIRE(!texture2.isLoading());
+            tgui::TextureManager::setAsyncUploadBudget(4 * 1024 * 1024);
+        }
+    }
+
     SECTION("Copy and destruct")
     {
         unsigned int copyCount = 0;
@@ -219,6 +303,206 @@ TEST_CASE("[Texture]")
         REQUIRE(tgui::Texture("resources/image.png").isSmooth());
     }
 
+    SECTION("PixelStorage")
+    {
+        // Textures keep all their pixels by default
+        REQUIRE(tgui::BackendTexture::getDefaultPixelStorage() == tgui::BackendTexture::PixelStorage::Full);
+        tgui::Texture fullTexture{"resources/TransparentParts.png"};
+        REQUIRE(fullTexture.getData()->backendTexture->getPixelStorage() == tgui::BackendTexture::PixelStorage::Full);
+        REQUIRE(fullTexture.getData()->backendTexture->getPixels() != nullptr);
+
+        tgui::BackendTexture::setDefaultPixelStorage(tgui::BackendTexture::PixelStorage::AlphaMask);
+        REQUIRE(tgui::BackendTexture::getDefaultPixelStorage() == tgui::BackendTexture::PixelStorage::AlphaMask);
+        tgui::Texture maskTexture{"resources/TransparentParts.png", {}, {}, false};
+        REQUIRE(maskTexture.getData()->backendTexture->getPixelStorage() == tgui::BackendTexture::PixelStorage::AlphaMask);
+        REQUIRE(maskTexture.getData()->backendTexture->getPixels() == nullptr);
+
+        unsigned int transparentPixels = 0;
+        unsigned int differentPixels = 0;
+        for (unsigned int y = 0; y < 50; ++y)
+        {
+            for (unsigned int x = 0; x < 50; ++x)
+            {
+                if (fullTexture.isTransparentPixel({x, y}))
+                    ++transparentPixels;
+                if (fullTexture.isTransparentPixel({x, y}) != maskTexture.isTransparentPixel({x, y}))
+                    ++differentPixels;
+            }
+        }
+        REQUIRE(transparentPixels > 0);
+        REQUIRE(transparentPixels < 50 * 50);
+        REQUIRE(differentPixels == 0);
+
+        // The alpha mask is kept up-to-date when part of the texture changes
+        auto backendTexture = tgui::getBackend()->createTexture();
+        auto pixels = std::make_unique<std::uint8_t[]>(10 * 2 * 4);
+        for (unsigned int i = 0; i < 10 * 2; ++i)
+            pixels[i * 4 + 3] = ((i % 3) == 0) ? 0 : 255;
+        REQUIRE(backendTexture->load({10, 2}, std::move(pixels), true));
+        REQUIRE(backendTexture->isTransparentPixel({0, 0}));
+        REQUIRE(!backendTexture->isTransparentPixel({1, 0}));
+        REQUIRE(backendTexture->isTransparentPixel({9, 0}));
+        REQUIRE(!backendTexture->isTransparentPixel({0, 1}));
+        REQUIRE(backendTexture->isTransparentPixel({2, 1}));
+
+        const std::uint8_t updatedPixels[] = {255, 255, 255, 255,  255, 255, 255, 0};
+        (void)backendTexture->update({8, 1, 2, 1}, updatedPixels);
+        REQUIRE(!backendTexture->isTransparentPixel({8, 1}));
+        REQUIRE(backendTexture->isTransparentPixel({9, 1}));
+        REQUIRE(backendTexture->isTransparentPixel({9, 0}));
+
+        // Without stored pixel data, no pixel is considered transparent
+        tgui::BackendTexture::setDefaultPixelStorage(tgui::BackendTexture::PixelStorage::None);
+        backendTexture = tgui::getBackend()->createTexture();
+        pixels = std::make_unique<std::uint8_t[]>(4);
+        REQUIRE(backendTexture->load({1, 1}, std::move(pixels), true));
+        REQUIRE(backendTexture->getPixels() == nullptr);
+        REQUIRE(!backendTexture->isTransparentPixel({0, 0}));
+
+        tgui::BackendTexture::setDefaultPixelStorage(tgui::BackendTexture::PixelStorage::Full);
+    }
+
+    SECTION("Frame upload budget")
+    {
+        REQUIRE(tgui::BackendTexture::getUploadBudget() == 4 * 1024 * 1024);
+        tgui::BackendTexture::setUploadBudget(300);
+        REQUIRE(tgui::BackendTexture::getUploadBudget() == 300);
+        REQUIRE(tgui::TextureManager::getAsyncUploadBudget() == 300);
+
+        tgui::BackendTexture::resetUploadedByteCount();
+        REQUIRE(tgui::BackendTexture::getUploadedByteCount() == 0);
+        REQUIRE(tgui::BackendTexture::isWithinUploadBudget(300));
+        REQUIRE(!tgui::BackendTexture::isWithinUploadBudget(301));
+
+        // Every upload counts towards the budget, only creating an empty texture doesn't
+        auto backendTexture = tgui::getBackend()->createTexture();
+        REQUIRE(backendTexture->loadTextureOnly({10, 5}, nullptr, true));
+        REQUIRE(tgui::BackendTexture::getUploadedByteCount() == 0);
+        REQUIRE(backendTexture->load({10, 5}, std::make_unique<std::uint8_t[]>(4 * 10 * 5), true));
+        REQUIRE(tgui::BackendTexture::getUploadedByteCount() == 200);
+        REQUIRE(tgui::BackendTexture::isWithinUploadBudget(100));
+        REQUIRE(!tgui::BackendTexture::isWithinUploadBudget(101));
+
+        const std::uint8_t pixels[4 * 2 * 2] = {};
+        REQUIRE(backendTexture->update({1, 1, 2, 2}, pixels));
+        REQUIRE(tgui::BackendTexture::getUploadedByteCount() >= 216);
+
+        backendTexture = tgui::getBackend()->createTexture();
+        REQUIRE(backendTexture->load({10, 5}, std::make_unique<std::uint8_t[]>(4 * 10 * 5), true));
+        REQUIRE(!tgui::BackendTexture::isWithinUploadBudget(0));
+
+        tgui::BackendTexture::resetUploadedByteCount();
+        REQUIRE(tgui::BackendTexture::getUploadedByteCount() == 0);
+        tgui::BackendTexture::setUploadBudget(4 * 1024 * 1024);
+    }
+
+    SECTION("ImageLoader")
+    {
+        tgui::Vector2u imageSize;
+        REQUIRE(tgui::ImageLoader::loadFromFile("resources/NonExistentFile.png", imageSize) == nullptr);
+
+        // Decoding while reading the file gives the same result as decoding the file from memory
+        std::size_t fileSize;
+        const auto fileContents = tgui::readFileToMemory("resources/KnobBack.png", fileSize);
+        REQUIRE(fileContents);
+
+        tgui::Vector2u memoryImageSize;
+        const auto memoryPixels = tgui::ImageLoader::loadFromMemory(fileContents.get(), fileSize, memoryImageSize);
+        REQUIRE(memoryPixels);
+        REQUIRE(memoryImageSize == tgui::Vector2u{200, 200});
+
+        const auto filePixels = tgui::ImageLoader::loadFromFile("resources/KnobBack.png", imageSize);
+        REQUIRE(filePixels);
+        REQUIRE(imageSize == memoryImageSize);
+        REQUIRE(std::memcmp(filePixels.get(), memoryPixels.get(), 4 * 200 * 200) == 0);
+    }
+
+    SECTION("Disk cache")
+    {
+        const tgui::Filesystem::Path cacheDir("texture-disk-cache");
+        REQUIRE(tgui::Filesystem::createDirectory(cacheDir));
+
+        // Start without the cache files that an earlier run of the tests may have left behind
+        const auto removeCacheFiles = [&cacheDir]{
+            for (const auto& file : tgui::Filesystem::listFilesInDirectory(cacheDir))
+                std::remove(file.path.asString().toStdString().c_str());
+        };
+        removeCacheFiles();
+
+        REQUIRE(tgui::ImageLoader::getDiskCacheDirectory().isEmpty());
+        tgui::ImageLoader::setDiskCacheDirectory(cacheDir);
+        REQUIRE(tgui::ImageLoader::getDiskCacheDirectory() == cacheDir);
+
+        tgui::Vector2u decodedSize;
+        const auto decodedPixels = tgui::ImageLoader::loadFromFile("resources/image.png", decodedSize);
+        REQUIRE(decodedPixels);
+        const std::size_t pixelDataSize = 4 * decodedSize.x * decodedSize.y;
+
+        const auto cacheFiles = tgui::Filesystem::listFilesInDirectory(cacheDir);
+        REQUIRE(cacheFiles.size() == 1);
+        REQUIRE(cacheFiles[0].fileSize > pixelDataSize);
+
+        // The second time the pixels are read from the cache
+        tgui::Vector2u cachedSize;
+        auto cachedPixels = tgui::ImageLoader::loadFromFile("resources/image.png", cachedSize);
+        REQUIRE(cachedPixels);
+        REQUIRE(cachedSize == decodedSize);
+        REQUIRE(std::memcmp(cachedPixels.get(), decodedPixels.get(), pixelDataSize) == 0);
+
+        // An invalid cache file is ignored and replaced
+        REQUIRE(tgui::writeFile(cacheFiles[0].path.asString(), "TGUIIMG1"));
+        cachedPixels = tgui::ImageLoader::loadFromFile("resources/image.png", cachedSize);
+        REQUIRE(cachedPixels);
+        REQUIRE(std::memcmp(cachedPixels.get(), decodedPixels.get(), pixelDataSize) == 0);
+
+        tgui::Filesystem::FileInfo cacheFileInfo;
+        REQUIRE(tgui::Filesystem::getFileInfo(cacheFiles[0].path, cacheFileInfo));
+        REQUIRE(cacheFileInfo.fileSize == cacheFiles[0].fileSize);
+
+        // A cache file with an image size that doesn't match the pixel data is ignored
+        std::size_t cacheFileSize;
+        const auto cacheFileData = tgui::readFileToMemory(cacheFiles[0].path.asString(), cacheFileSize);
+        REQUIRE(cacheFileData);
+        REQUIRE(cacheFileSize == cacheFiles[0].fileSize);
+
+        std::string corruptCacheFile(reinterpret_cast<const char*>(cacheFileData.get()), cacheFileSize);
+        std::memset(&corruptCacheFile[8], 0xFF, 8); // Width and height
+        REQUIRE(tgui::writeFile(cacheFiles[0].path.asString(), tgui::CharStringView(corruptCacheFile.data(), corruptCacheFile.size())));
+        cachedPixels = tgui::ImageLoader::loadFromFile("resources/image.png", cachedSize);
+        REQUIRE(cachedPixels);
+        REQUIRE(cachedSize == decodedSize);
+        REQUIRE(std::memcmp(cachedPixels.get(), decodedPixels.get(), pixelDataSize) == 0);
+
+        // A truncated cache file is ignored as well
+        REQUIRE(tgui::writeFile(cacheFiles[0].path.asString(), tgui::CharStringView(reinterpret_cast<const char*>(cacheFileData.get()), cacheFileSize - 1)));
+        cachedPixels = tgui::ImageLoader::loadFromFile("resources/image.png", cachedSize);
+        REQUIRE(cachedPixels);
+        REQUIRE(std::memcmp(cachedPixels.get(), decodedPixels.get(), pixelDataSize) == 0);
+
+        // The cache files are written to a temporary file first, which is renamed afterwards
+        const auto cacheFilesAfterRewrite = tgui::Filesystem::listFilesInDirectory(cacheDir);
+        REQUIRE(cacheFilesAfterRewrite.size() == 1);
+        REQUIRE(cacheFilesAfterRewrite[0].path == cacheFiles[0].path);
+        REQUIRE(cacheFilesAfterRewrite[0].fileSize == cacheFiles[0].fileSize);
+
+        // Images that are loaded asynchronously also end up in the cache
+        {
+            tgui::Texture texture;
+            texture.loadAsync("resources/image.jpg");
+            for (unsigned int i = 0; (i < 1000) && (tgui::TextureManager::getAsyncLoadCount() > 0); ++i)
+            {
+                if (!tgui::TextureManager::processAsyncLoads())
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            REQUIRE(tgui::TextureManager::getAsyncLoadCount() == 0);
+            REQUIRE(!texture.isLoading());
+        }
+        REQUIRE(tgui::Filesystem::listFilesInDirectory(cacheDir).size() == 2);
+
+        tgui::ImageLoader::setDiskCacheDirectory({});
+        removeCacheFiles();
+    }
+
     SECTION("Color")
     {
         tgui::Texture texture{"resources/image.png"};
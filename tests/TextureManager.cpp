@@ -56,4 +56,187 @@ TEST_CASE("[TextureManager]")
     REQUIRE_THROWS_AS(tgui::TextureManager::removeTexture(textureData1), tgui::Exception);
 
     REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData3));
+
+    SECTION("Cache budget")
+    {
+        REQUIRE(tgui::TextureManager::getCacheBudget() == 0);
+        tgui::TextureManager::resetStatistics();
+
+        // Other tests may still be using some images
+        const std::size_t initialImageCount = tgui::TextureManager::getCachedImagesCount();
+        const std::size_t initialBytes = tgui::TextureManager::getStatistics().bytesResident;
+
+        // Without a budget, images are removed as soon as they are no longer used
+        {
+            tgui::Texture texture{"resources/image.png"};
+            REQUIRE(tgui::TextureManager::getStatistics().bytesResident == initialBytes + 50 * 50 * 4);
+        }
+        REQUIRE(tgui::TextureManager::getStatistics().misses == 1);
+        REQUIRE(tgui::TextureManager::getStatistics().bytesResident == initialBytes);
+        REQUIRE(tgui::TextureManager::getCachedImagesCount() == initialImageCount);
+
+        tgui::TextureManager::setCacheBudget(2 * 50 * 50 * 4);
+        REQUIRE(tgui::TextureManager::getCacheBudget() == 2 * 50 * 50 * 4);
+
+        {
+            tgui::Texture texture{"resources/image.png"};
+        }
+        REQUIRE(tgui::TextureManager::getStatistics().misses == 2);
+        REQUIRE(tgui::TextureManager::getStatistics().unusedImages == 1);
+        REQUIRE(tgui::TextureManager::getStatistics().bytesUnused == 50 * 50 * 4);
+        REQUIRE(tgui::TextureManager::getStatistics().bytesResident == initialBytes + 50 * 50 * 4);
+
+        // The unused image is reused
+        {
+            tgui::Texture texture{"resources/image.png"};
+            REQUIRE(tgui::TextureManager::getStatistics().hits == 1);
+            REQUIRE(tgui::TextureManager::getStatistics().unusedImages == 0);
+            REQUIRE(tgui::TextureManager::getStatistics().bytesUnused == 0);
+        }
+
+        // The least recently used image is removed when the budget is exceeded
+        {
+            tgui::Texture texture1{"resources/Texture1.png"};
+            tgui::Texture texture2{"resources/Texture2.png"};
+        }
+        REQUIRE(tgui::TextureManager::getStatistics().misses == 4);
+        REQUIRE(tgui::TextureManager::getStatistics().evictions == 1);
+        REQUIRE(tgui::TextureManager::getStatistics().unusedImages == 2);
+        REQUIRE(tgui::TextureManager::getCachedImagesCount() == initialImageCount + 2);
+
+        {
+            tgui::Texture texture{"resources/image.png"};
+            REQUIRE(tgui::TextureManager::getStatistics().misses == 5);
+        }
+        REQUIRE(tgui::TextureManager::getStatistics().evictions == 2);
+
+        // Reusing an image makes it the most recently used one again
+        {
+            tgui::Texture texture{"resources/Texture1.png"};
+            REQUIRE(tgui::TextureManager::getStatistics().hits == 2);
+        }
+        {
+            tgui::Texture texture{"resources/Texture2.png"};
+            REQUIRE(tgui::TextureManager::getStatistics().misses == 6);
+        }
+        REQUIRE(tgui::TextureManager::getStatistics().evictions == 3);
+        {
+            tgui::Texture texture{"resources/Texture1.png"};
+            REQUIRE(tgui::TextureManager::getStatistics().hits == 3);
+        }
+
+        tgui::TextureManager::removeUnusedTextures();
+        REQUIRE(tgui::TextureManager::getCachedImagesCount() == initialImageCount);
+        REQUIRE(tgui::TextureManager::getStatistics().bytesResident == initialBytes);
+
+        tgui::TextureManager::setCacheBudget(0);
+        tgui::TextureManager::resetStatistics();
+        REQUIRE(tgui::TextureManager::getStatistics().misses == 0);
+    }
+
+    SECTION("Texture atlas")
+    {
+        REQUIRE(!tgui::TextureManager::getAtlasEnabled());
+        REQUIRE(tgui::TextureManager::getAtlasImageSizeLimit() == 64);
+        REQUIRE(tgui::TextureManager::getAtlasPageCount() == 0);
+
+        tgui::TextureManager::setAtlasEnabled(true);
+        REQUIRE(tgui::TextureManager::getAtlasEnabled());
+
+        {
+            tgui::Texture atlasTexture1{"resources/image.png"};
+            tgui::Texture atlasTexture2{"resources/TransparentParts.png"};
+            REQUIRE(tgui::TextureManager::getAtlasPageCount() == 1);
+            REQUIRE(atlasTexture1.getData()->backendTexture == atlasTexture2.getData()->backendTexture);
+            REQUIRE(atlasTexture1.getData()->atlasRect != atlasTexture2.getData()->atlasRect);
+            REQUIRE(atlasTexture1.getData()->atlasRect.getSize() == tgui::Vector2u{50, 50});
+            REQUIRE(atlasTexture1.getImageSize() == tgui::Vector2u{50, 50});
+            REQUIRE(atlasTexture1.getPartRect() == tgui::UIntRect{0, 0, 50, 50});
+            REQUIRE(!atlasTexture1.getData()->backendTexture->getMipmapsAllowed());
+
+            // Images loaded without smoothing end up in a different atlas page
+            tgui::Texture atlasTexture3{"resources/image.png", {}, {}, false};
+            REQUIRE(tgui::TextureManager::getAtlasPageCount() == 2);
+            REQUIRE(atlasTexture1.getData()->backendTexture != atlasTexture3.getData()->backendTexture);
+
+            // Larger images still get their own texture
+            tgui::TextureManager::setAtlasImageSizeLimit(32);
+            REQUIRE(tgui::TextureManager::getAtlasImageSizeLimit() == 32);
+            tgui::Texture atlasTexture4{"resources/Texture1.png"};
+            REQUIRE(atlasTexture4.getData()->atlasRect == tgui::UIntRect{});
+            REQUIRE(atlasTexture4.getData()->backendTexture->getSize() == tgui::Vector2u{50, 50});
+            REQUIRE(atlasTexture4.getData()->backendTexture->getMipmapsAllowed());
+            tgui::TextureManager::setAtlasImageSizeLimit(64);
+
+            tgui::TextureManager::setAtlasEnabled(false);
+            tgui::Texture normalTexture{"resources/TransparentParts.png", {}, {}, false};
+            REQUIRE(normalTexture.getData()->atlasRect == tgui::UIntRect{});
+            unsigned int differentPixels = 0;
+            for (unsigned int y = 0; y < 50; ++y)
+            {
+                for (unsigned int x = 0; x < 50; ++x)
+                {
+                    if (atlasTexture2.isTransparentPixel({x, y}) != normalTexture.isTransparentPixel({x, y}))
+                        ++differentPixels;
+                }
+            }
+            REQUIRE(differentPixels == 0);
+
+            // Part rects are relative to the image, not to the atlas page
+            tgui::TextureManager::setAtlasEnabled(true);
+            tgui::Texture partTexture{"resources/TransparentParts.png", {10, 20, 30, 25}};
+            REQUIRE(partTexture.getData() == atlasTexture2.getData());
+            REQUIRE(partTexture.getImageSize() == tgui::Vector2u{30, 25});
+            REQUIRE(partTexture.isTransparentPixel({5, 5}) == normalTexture.isTransparentPixel({15, 25}));
+        }
+
+        // The pages are released when none of their images are still used
+        REQUIRE(tgui::TextureManager::getAtlasPageCount() == 0);
+
+        // Images can still be placed in the atlas when textures don't store their pixels by default
+        tgui::BackendTexture::setDefaultPixelStorage(tgui::BackendTexture::PixelStorage::None);
+        {
+            tgui::Texture atlasTexture{"resources/image.png"};
+            REQUIRE(tgui::TextureManager::getAtlasPageCount() == 1);
+            REQUIRE(atlasTexture.getData()->atlasRect == tgui::UIntRect{1, 1, 50, 50});
+        }
+        tgui::BackendTexture::setDefaultPixelStorage(tgui::BackendTexture::PixelStorage::Full);
+        REQUIRE(tgui::TextureManager::getAtlasPageCount() == 0);
+
+        tgui::TextureManager::setAtlasEnabled(false);
+    }
+    SECTION("Downscaling")
+    {
+        tgui::Texture largeTexture{"resources/KnobBack.png"};
+        REQUIRE(largeTexture.getImageSize() == tgui::Vector2u{200, 200});
+
+        tgui::Sprite sprite{largeTexture};
+        sprite.setSize({50, 50});
+        REQUIRE(sprite.getDownscaledTexture() == nullptr);
+
+        tgui::TextureManager::setDownscalingEnabled(true);
+        const std::size_t initialBytes = tgui::TextureManager::getStatistics().bytesResident;
+
+        // The largest power of two is used that doesn't make the image smaller than the sprite
+        sprite.setSize({60, 50});
+        const auto downscaledTexture = sprite.getDownscaledTexture();
+        REQUIRE(downscaledTexture != nullptr);
+        REQUIRE(downscaledTexture->getSize() == tgui::Vector2u{100, 100});
+        REQUIRE(tgui::TextureManager::getStatistics().bytesResident == initialBytes + (4 * 100 * 100));
+
+        // Sprites showing the image at a similar size share the downscaled copy
+        tgui::Sprite sprite2{largeTexture};
+        sprite2.setSize({90, 70});
+        REQUIRE(sprite2.getDownscaledTexture() == downscaledTexture);
+
+        sprite2.setSize({50, 50});
+        REQUIRE(sprite2.getDownscaledTexture() != nullptr);
+        REQUIRE(sprite2.getDownscaledTexture()->getSize() == tgui::Vector2u{50, 50});
+
+        // Images that are drawn at a size that is close to their actual size are drawn directly
+        sprite2.setSize({120, 120});
+        REQUIRE(sprite2.getDownscaledTexture() == nullptr);
+
+        tgui::TextureManager::setDownscalingEnabled(false);
+    }
 }
@@ -168,4 +168,44 @@ TEST_CASE("[Timer]")
         duration = tgui::Timer::getNextScheduledTime();
         REQUIRE(!duration); // No active timers
     }
+
+    SECTION("Many timers")
+    {
+        std::vector<unsigned int> triggeredTimers;
+        std::vector<std::shared_ptr<tgui::Timer>> timers;
+        const auto getInterval = [](unsigned int i){ return std::chrono::milliseconds(100 + 10 * ((i * 37) % 100)); };
+        for (unsigned int i = 0; i < 100; ++i)
+            timers.push_back(tgui::Timer::create([&triggeredTimers,i]{ triggeredTimers.push_back(i); }, getInterval(i)));
+
+        for (unsigned int i = 1; i < 100; i += 2)
+            timers[i]->setEnabled(false);
+
+        REQUIRE(*tgui::Timer::getNextScheduledTime() == std::chrono::milliseconds(100));
+
+        // All timers that expire in the same update are triggered in the order of their deadline
+        tgui::Timer::updateTime(std::chrono::milliseconds(1090));
+        REQUIRE(triggeredTimers.size() == 50);
+        for (std::size_t i = 1; i < triggeredTimers.size(); ++i)
+            REQUIRE(getInterval(triggeredTimers[i-1]) < getInterval(triggeredTimers[i]));
+
+        REQUIRE(*tgui::Timer::getNextScheduledTime() == std::chrono::milliseconds(100));
+
+        // Timers with the same deadline are triggered in the order in which they were started
+        for (auto& timer : timers)
+            timer->setEnabled(false);
+        REQUIRE(!tgui::Timer::getNextScheduledTime());
+
+        triggeredTimers.clear();
+        for (const unsigned int i : {5u, 2u, 7u})
+        {
+            timers[i]->setInterval(50);
+            timers[i]->setEnabled(true);
+        }
+
+        tgui::Timer::updateTime(std::chrono::milliseconds(50));
+        REQUIRE(triggeredTimers == std::vector<unsigned int>{5, 2, 7});
+
+        for (auto& timer : timers)
+            timer->setEnabled(false);
+    }
 }
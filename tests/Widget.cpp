@@ -26,6 +26,22 @@
 
 #include "Tests.hpp"
 
+#include <TGUI/RendererDefines.hpp>
+
+namespace
+{
+    class CustomRenderer : public tgui::WidgetRenderer
+    {
+    public:
+        using WidgetRenderer::WidgetRenderer;
+
+        void setCustomColor(tgui::Color color);
+        TGUI_NODISCARD tgui::Color getCustomColor() const;
+    };
+
+    TGUI_RENDERER_PROPERTY_COLOR(CustomRenderer, CustomColor, tgui::Color::Green)
+}
+
 TEST_CASE("[Widget]")
 {
     tgui::Widget::Ptr widget = tgui::ClickableWidget::create();
@@ -449,6 +465,47 @@ TEST_CASE("[Widget]")
             REQUIRE(renderer->getProperty("NonexistentProperty").getType() == tgui::ObjectConverter::Type::None);
         }
 
+        SECTION("Property ids")
+        {
+            REQUIRE(tgui::WidgetRenderer::getPropertyId("Opacity") == tgui::RendererPropertyId::Opacity);
+            REQUIRE(tgui::WidgetRenderer::getPropertyId("TextureThumbHover") == tgui::RendererPropertyId::TextureThumbHover);
+            REQUIRE(tgui::WidgetRenderer::getPropertyName(tgui::RendererPropertyId::BorderColorHover) == "BorderColorHover");
+
+            const tgui::RendererPropertyId customId = tgui::WidgetRenderer::getPropertyId("SomeCustomProperty");
+            REQUIRE(static_cast<std::uint32_t>(customId) >= static_cast<std::uint32_t>(tgui::RendererPropertyId::KnownPropertyCount));
+            REQUIRE(tgui::WidgetRenderer::getPropertyId("SomeCustomProperty") == customId);
+            REQUIRE(tgui::WidgetRenderer::getPropertyId("SomeOtherCustomProperty") != customId);
+            REQUIRE(tgui::WidgetRenderer::getPropertyName(customId) == "SomeCustomProperty");
+
+            // Widgets that override the string-based function still get notified
+            class CustomWidget : public tgui::ClickableWidget
+            {
+            public:
+                std::vector<tgui::String> changedProperties;
+
+            protected:
+                void rendererChanged(const tgui::String& property) override
+                {
+                    changedProperties.push_back(property);
+                    if (property != "SomeCustomProperty")
+                        ClickableWidget::rendererChanged(property);
+                }
+            };
+
+            auto customWidget = std::make_shared<CustomWidget>();
+            customWidget->getRenderer()->setProperty("SomeCustomProperty", 5);
+            customWidget->getRenderer()->setOpacity(0.5f);
+            REQUIRE(customWidget->changedProperties == std::vector<tgui::String>{"SomeCustomProperty", "Opacity"});
+            REQUIRE(customWidget->getRenderer()->getOpacity() == 0.5f);
+
+            // The renderer macros also work for properties that don't have a named id
+            CustomRenderer customRenderer{tgui::RendererData::create()};
+            REQUIRE(customRenderer.getCustomColor() == tgui::Color::Green);
+            customRenderer.setCustomColor(tgui::Color::Red);
+            REQUIRE(customRenderer.getCustomColor() == tgui::Color::Red);
+            REQUIRE(customRenderer.getProperty("CustomColor").getColor() == tgui::Color::Red);
+        }
+
         SECTION("Clone")
         {
             renderer->setOpacity(0.5f);
@@ -132,6 +132,61 @@ TEST_CASE("[ChatBox]")
             REQUIRE(chatBox->getLine(0) == "Line 4");
             REQUIRE(chatBox->getLine(1) == "Line 3");
         }
+
+        SECTION("Many lines")
+        {
+            chatBox->setSize(150, 100);
+            chatBox->setLineLimit(500);
+
+            for (unsigned int i = 1; i <= 2000; ++i)
+                chatBox->addLine("Line " + tgui::String::fromNumber(i));
+
+            REQUIRE(chatBox->getLineAmount() == 500);
+            REQUIRE(chatBox->getLine(0) == "Line 1501");
+            REQUIRE(chatBox->getLine(499) == "Line 2000");
+
+            // The scrollbar stays at the bottom and matches the value after recalculating all lines
+            const unsigned int scrollbarValue = chatBox->getScrollbarValue();
+            REQUIRE(scrollbarValue > 0);
+            chatBox->setSize(150, 100);
+            REQUIRE(chatBox->getScrollbarValue() == scrollbarValue);
+
+            REQUIRE(chatBox->removeLine(250));
+            REQUIRE(chatBox->removeLine(0));
+            REQUIRE(chatBox->getLineAmount() == 498);
+            const unsigned int scrollbarValueAfterRemove = chatBox->getScrollbarValue();
+            REQUIRE(scrollbarValueAfterRemove < scrollbarValue);
+            chatBox->setSize(150, 100);
+            REQUIRE(chatBox->getScrollbarValue() == scrollbarValueAfterRemove);
+        }
+    }
+
+    SECTION("Batch update")
+    {
+        auto chatBoxWithoutBatch = tgui::ChatBox::create();
+        chatBoxWithoutBatch->getRenderer()->setFont("resources/DejaVuSans.ttf");
+        for (auto& box : {chatBox, chatBoxWithoutBatch})
+            box->setSize(150, 100);
+
+        chatBox->beginUpdate();
+        for (unsigned int i = 0; i < 100; ++i)
+        {
+            chatBox->addLine("Line " + tgui::String::fromNumber(i));
+            chatBoxWithoutBatch->addLine("Line " + tgui::String::fromNumber(i));
+        }
+
+        REQUIRE(chatBox->getLineAmount() == 100);
+        REQUIRE(chatBox->getScrollbarValue() == 0);
+
+        chatBox->endUpdate();
+        REQUIRE(chatBox->getScrollbarValue() > 0);
+        REQUIRE(chatBox->getScrollbarValue() == chatBoxWithoutBatch->getScrollbarValue());
+
+        // Calling endUpdate too often is ignored
+        chatBox->endUpdate();
+        chatBox->removeLine(99);
+        chatBoxWithoutBatch->removeLine(99);
+        REQUIRE(chatBox->getScrollbarValue() == chatBoxWithoutBatch->getScrollbarValue());
     }
 
     SECTION("Text size")
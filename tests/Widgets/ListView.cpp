@@ -174,6 +174,73 @@ TEST_CASE("[ListView]")
         REQUIRE(listView->getItemRows() == std::vector<std::vector<tgui::String>>{{"1,1", "a,2"}, {"b,1", ""}, {"c,1", "c,2"}});
     }
 
+    SECTION("Batch update")
+    {
+        // The scrollbars should end up the same as when the items were added without batching
+        auto listViewWithoutBatch = tgui::ListView::create();
+        listViewWithoutBatch->getRenderer()->setFont("resources/DejaVuSans.ttf");
+        for (auto& view : {listView, listViewWithoutBatch})
+        {
+            view->setSize(150, 100);
+            view->setItemHeight(20);
+        }
+
+        listView->beginUpdate();
+        listView->beginUpdate();
+        for (unsigned int i = 0; i < 50; ++i)
+        {
+            listView->addItem("Item " + tgui::String::fromNumber(i));
+            listViewWithoutBatch->addItem("Item " + tgui::String::fromNumber(i));
+        }
+
+        listView->addItem("A much wider item than all the others");
+        listViewWithoutBatch->addItem("A much wider item than all the others");
+        listView->removeItem(0);
+        listViewWithoutBatch->removeItem(0);
+        listView->endUpdate();
+        REQUIRE(listView->getVerticalScrollbarValue() == 0);
+
+        listView->endUpdate();
+        REQUIRE(listView->getItemCount() == 50);
+        REQUIRE(listView->getVerticalScrollbarValue() > 0);
+        REQUIRE(listView->getVerticalScrollbarValue() == listViewWithoutBatch->getVerticalScrollbarValue());
+
+        // Removing the widest item requires the width of the remaining items to be recalculated
+        listView->beginUpdate();
+        listView->removeItem(49);
+        listView->endUpdate();
+        listViewWithoutBatch->removeItem(49);
+        for (auto& view : {listView, listViewWithoutBatch})
+            view->setHorizontalScrollbarValue(1000);
+        REQUIRE(listView->getHorizontalScrollbarValue() == listViewWithoutBatch->getHorizontalScrollbarValue());
+
+        // Calling endUpdate too often is ignored
+        listView->endUpdate();
+        listView->addItem("Item");
+        REQUIRE(listView->getVerticalScrollbarValue() == listViewWithoutBatch->getVerticalScrollbarValue() + 20);
+        listView->removeItem(listView->getItemCount() - 1);
+
+        // Auto-scrolling to a sorted item waits until the maximum of the scrollbar has been updated
+        for (auto& view : {listView, listViewWithoutBatch})
+        {
+            view->setAutoSort(0, [](const tgui::String& a, const tgui::String& b){ return a < b; });
+            view->setVerticalScrollbarValue(0);
+        }
+
+        listView->beginUpdate();
+        for (unsigned int i = 0; i < 20; ++i)
+        {
+            listView->addItem("Z" + tgui::String::fromNumber(i));
+            listViewWithoutBatch->addItem("Z" + tgui::String::fromNumber(i));
+        }
+        listView->addItem("Item 25b");
+        listViewWithoutBatch->addItem("Item 25b");
+        REQUIRE(listView->getVerticalScrollbarValue() == 0);
+        listView->endUpdate();
+        REQUIRE(listView->getVerticalScrollbarValue() > 0);
+        REQUIRE(listView->getVerticalScrollbarValue() == listViewWithoutBatch->getVerticalScrollbarValue());
+    }
+
     SECTION("Data")
     {
         listView->addColumn("Col 1");
@@ -224,6 +291,75 @@ TEST_CASE("[ListView]")
 
         listView->sort(2, cmp2);
         REQUIRE(listView->getItemRows() == std::vector<std::vector<tgui::String>>{{"200", "-5", "20"}, {"1000", "7", ""}, {"300", "", ""}});
+
+        SECTION("Selection is kept")
+        {
+            listView->setMultiSelect(true);
+            listView->setSelectedItems({0, 2});
+            listView->sort(0, cmp1);
+            REQUIRE(listView->getItemRows() == std::vector<std::vector<tgui::String>>{{"1000", "7", ""}, {"200", "-5", "20"}, {"300", "", ""}});
+            REQUIRE(listView->getSelectedItemIndices() == std::set<std::size_t>{1, 2});
+        }
+
+        SECTION("Sort by key")
+        {
+            auto toNumber = [](const tgui::String& str) { return static_cast<double>(str.toFloat()); };
+
+            listView->sortByKey(0, toNumber);
+            REQUIRE(listView->getItems() == std::vector<tgui::String>{"200", "300", "1000"});
+
+            listView->sortByKey(0, toNumber, false);
+            REQUIRE(listView->getItems() == std::vector<tgui::String>{"1000", "300", "200"});
+
+            // Items with equal keys keep their order
+            listView->sortByKey(2, toNumber);
+            REQUIRE(listView->getItems() == std::vector<tgui::String>{"1000", "300", "200"});
+            listView->sortByKey(2, toNumber, false);
+            REQUIRE(listView->getItems() == std::vector<tgui::String>{"200", "1000", "300"});
+
+            // Parallel sorting gives the same result as sorting on a single thread
+            std::vector<std::vector<tgui::String>> manyItems;
+            for (unsigned int i = 0; i < 5000; ++i)
+                manyItems.push_back({tgui::String::fromNumber((i * 7919) % 1000), tgui::String::fromNumber(i)});
+
+            listView->removeAllItems();
+            listView->addMultipleItems(manyItems);
+            listView->sortByKey(0, toNumber, true, true);
+            const auto parallelRows = listView->getItemRows();
+
+            listView->removeAllItems();
+            listView->addMultipleItems(manyItems);
+            listView->sortByKey(0, toNumber, true, false);
+            REQUIRE(listView->getItemRows() == parallelRows);
+            REQUIRE(listView->getItemCell(0, 0) == "0");
+            REQUIRE(listView->getItemCell(0, 1) == "0");
+            REQUIRE(listView->getItemCell(4999, 0) == "999");
+
+            // The comparator-based sort can also be spread over multiple threads
+            listView->removeAllItems();
+            listView->addMultipleItems(manyItems);
+            listView->sortParallel(0, [](const tgui::String& a, const tgui::String& b) { return a.toInt() < b.toInt(); });
+            REQUIRE(listView->getItemRows() == parallelRows);
+        }
+
+        SECTION("Auto sort")
+        {
+            listView->setAutoSort(0, cmp1);
+            REQUIRE(listView->getItems() == std::vector<tgui::String>{"1000", "200", "300"});
+
+            REQUIRE(listView->addItem("250") == 2);
+            REQUIRE(listView->addItem(std::vector<tgui::String>{"0"}) == 0);
+            REQUIRE(listView->addItem("999") == 5);
+            REQUIRE(listView->getItems() == std::vector<tgui::String>{"0", "1000", "200", "250", "300", "999"});
+
+            listView->setSelectedItem(3);
+            listView->addMultipleItems({{"3"}, {"1"}, {"25"}});
+            REQUIRE(listView->getItems() == std::vector<tgui::String>{"0", "1", "1000", "200", "25", "250", "3", "300", "999"});
+            REQUIRE(listView->getSelectedItemIndex() == 5);
+
+            listView->setAutoSort(0, nullptr);
+            REQUIRE(listView->addItem("2") == 9);
+        }
     }
 
     SECTION("Returned item rows depend on columns")
@@ -262,6 +262,87 @@ TEST_CASE("[PanelListBox]")
         REQUIRE(panelListBox->getItemByIndex(2) == panel3);
     }
 
+    SECTION("Recycling mode")
+    {
+        panelListBox->setSize(150, 100);
+        panelListBox->setItemsHeight(20);
+        panelListBox->addItem("1");
+
+        std::vector<std::size_t> boundIndices;
+        unsigned int createdPanels = 0;
+        panelListBox->setRecyclingMode(10000,
+            [&](const tgui::Panel::Ptr& panel, std::size_t index){
+                panel->setUserData(index);
+                boundIndices.push_back(index);
+            },
+            [&]{
+                ++createdPanels;
+                return tgui::Panel::create();
+            });
+
+        REQUIRE(panelListBox->isRecyclingMode());
+        REQUIRE(panelListBox->getItemCount() == 10000);
+        REQUIRE(panelListBox->getItems().empty());
+        REQUIRE(!panelListBox->addItem("2"));
+
+        // Only the visible items have a panel
+        REQUIRE(createdPanels == 5);
+        REQUIRE(boundIndices == std::vector<std::size_t>{0, 1, 2, 3, 4});
+        REQUIRE(panelListBox->getItemByIndex(4)->getUserData<std::size_t>() == 4);
+        REQUIRE(panelListBox->getItemByIndex(4)->getPosition() == tgui::Vector2f(0, 80));
+        REQUIRE(panelListBox->getIndexByItem(panelListBox->getItemByIndex(3)) == 3);
+        REQUIRE(!panelListBox->getItemByIndex(5));
+
+        // Scrolling only binds the items that come into view
+        boundIndices.clear();
+        panelListBox->setVerticalScrollbarValue(30);
+        REQUIRE(createdPanels == 6);
+        REQUIRE(panelListBox->getItemByIndex(1)->getUserData<std::size_t>() == 1);
+        REQUIRE(panelListBox->getItemByIndex(6)->getUserData<std::size_t>() == 6);
+        REQUIRE(!panelListBox->getItemByIndex(0));
+
+        boundIndices.clear();
+        panelListBox->setVerticalScrollbarValue(9000 * 20);
+        REQUIRE(createdPanels == 6);
+        REQUIRE(boundIndices.size() == 5);
+        REQUIRE(panelListBox->getItemByIndex(9002)->getUserData<std::size_t>() == 9002);
+        REQUIRE(panelListBox->getItemByIndex(9002)->getPosition() == tgui::Vector2f(0, 9002 * 20));
+
+        REQUIRE(panelListBox->setSelectedItemByIndex(9001));
+        REQUIRE(panelListBox->getSelectedItem() == panelListBox->getItemByIndex(9001));
+        REQUIRE(!panelListBox->setSelectedItemByIndex(10000));
+
+        // Removing items is done by changing the item count
+        REQUIRE(!panelListBox->removeItemByIndex(0));
+        panelListBox->setSelectedItemByIndex(9001);
+        panelListBox->setRecycledItemCount(50);
+        REQUIRE(panelListBox->getItemCount() == 50);
+        REQUIRE(panelListBox->getSelectedItemIndex() == -1);
+        REQUIRE(!panelListBox->getItemByIndex(9001));
+        REQUIRE(panelListBox->getItemByIndex(49)->getUserData<std::size_t>() == 49);
+
+        const auto copiedListBox = tgui::PanelListBox::copy(panelListBox);
+        REQUIRE(copiedListBox->getItemByIndex(49) != panelListBox->getItemByIndex(49));
+        REQUIRE(copiedListBox->getItemByIndex(49)->getPosition() == tgui::Vector2f(0, 49 * 20));
+
+        // The recycled panels aren't saved as ordinary items
+        auto parent = tgui::Group::create();
+        parent->add(copiedListBox, "List");
+        std::stringstream stream;
+        parent->saveWidgetsToStream(stream);
+        parent->removeAllWidgets();
+        parent->loadWidgetsFromStream(stream);
+        const auto loadedListBox = parent->get<tgui::PanelListBox>("List");
+        REQUIRE(loadedListBox);
+        REQUIRE(loadedListBox->getItemCount() == 0);
+        REQUIRE(loadedListBox->getWidgets().empty());
+
+        panelListBox->removeAllItems();
+        REQUIRE(!panelListBox->isRecyclingMode());
+        REQUIRE(panelListBox->getItemCount() == 0);
+        REQUIRE(panelListBox->getWidgets().empty());
+    }
+
     testWidgetSignals(panelListBox);
     SECTION("Events / Signals")
     {
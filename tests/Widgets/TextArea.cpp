@@ -235,6 +235,30 @@ TEST_CASE("[TextArea]")
         REQUIRE(textArea->getLinesCount() == 4);
     }
 
+    SECTION("Long text")
+    {
+        tgui::String text;
+        for (unsigned int i = 0; i < 1000; ++i)
+            text += "Line " + tgui::String(i) + "\n";
+
+        textArea->setText(text);
+        REQUIRE(textArea->getLinesCount() == 1001);
+
+        textArea->setVerticalScrollbarValue(5000);
+        REQUIRE(textArea->getVerticalScrollbarValue() == 5000);
+
+        textArea->setSelectedText(10, text.length() - 10);
+        REQUIRE(textArea->getSelectedText() == text.substr(10, text.length() - 20));
+
+        textArea->setVerticalScrollbarValue(0);
+        textArea->setSelectedText(text.length() - 3, 3);
+        REQUIRE(textArea->getSelectedText() == text.substr(3, text.length() - 6));
+
+        textArea->setText("Short");
+        REQUIRE(textArea->getLinesCount() == 1);
+        REQUIRE(textArea->getVerticalScrollbarValue() == 0);
+    }
+
     SECTION("Events / Signals")
     {
         textArea->setSize(165, 100);